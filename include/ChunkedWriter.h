@@ -0,0 +1,42 @@
+/*
+ * Streams a web server response in chunks from a fixed buffer
+ *
+ * Pages like /metrics are written piece by piece into a small buffer that
+ * is sent with WebServer::sendContent() whenever it fills up, so the size
+ * of the response never turns into a heap allocation.
+ *
+ * Author: Johan Coppieters for Duotecno
+ * Date: November 2025
+ */
+
+#ifndef CHUNKEDWRITER_H
+#define CHUNKEDWRITER_H
+
+#include <Arduino.h>
+#include <WebServer.h>
+
+#define CHUNKED_WRITER_SIZE 512
+
+class ChunkedWriter {
+public:
+  ChunkedWriter(WebServer* server) : server(server), len(0) {}
+
+  // Send the headers (200, chunked transfer), content is written after this
+  void begin(const char* contentType);
+  // Send what is left and the final (empty) chunk
+  void end();
+
+  void print(const char* text);
+  void print(char c);
+  void print(uint64_t value);        // No %llu needed (not every printf has it)
+  void printf(const char* format, ...) __attribute__((format(printf, 2, 3)));
+
+  void flush();
+
+private:
+  WebServer* server;
+  char buffer[CHUNKED_WRITER_SIZE];
+  size_t len;
+};
+
+#endif // CHUNKEDWRITER_H
@@ -0,0 +1,85 @@
+/*
+ * Cached address of the cloud server
+ *
+ * Every new free connection needs the address of the cloud server, but it
+ * hardly ever changes. The cache keeps the last answer and hands it out
+ * without a lookup while it is younger than DNS_CACHE_TTL. Well before
+ * that, loop() looks the name up again in the background. When a lookup
+ * fails or times out, the last known good address stays in use (counted as
+ * stale), so a flaky resolver doesn't stop us from making connections.
+ *
+ * lwIP doesn't hand the TTL of the DNS record to us, but it keeps the
+ * answers in its own table for as long as that TTL allows: a refresh
+ * within the record's TTL is answered from there without a round trip.
+ *
+ * Lookups use the asynchronous lwIP resolver, the answer is polled from
+ * loop(): nothing here ever blocks.
+ *
+ * Author: Johan Coppieters for Duotecno
+ * Date: November 2025
+ */
+
+#ifndef DNSCACHE_H
+#define DNSCACHE_H
+
+#include <Arduino.h>
+#include <lwip/dns.h>
+#include "config.h"
+
+class DnsCache {
+public:
+  DnsCache();
+
+  void begin(const char* hostname);  // Forget everything, cache this name from now on
+
+  // Address to connect to: true when we have one (fresh or stale)
+  // false if we never resolved the name yet, a lookup is started then (see isResolving())
+  bool lookup(IPAddress& address, unsigned long now);
+
+  // Finish a lookup or start a background refresh - call from every loop()
+  void loop(unsigned long now);
+
+  // Connecting to the cached address failed: it may have moved, look it up again
+  void suspect() { if (valid) expired = true; }
+
+  bool hasAddress() const { return valid; }
+  IPAddress getAddress() const { return address; }
+  bool isResolving() const { return resolving; }
+
+  // Statistics since boot
+  uint32_t getHits() const { return hits; }          // Fresh address from the cache
+  uint32_t getMisses() const { return misses; }      // Nothing cached, had to wait for a lookup
+  uint32_t getStale() const { return stale; }        // Expired address used (last known good)
+  uint32_t getLookups() const { return lookups; }    // Lookups started
+  uint32_t getFailures() const { return failures; }  // Lookups that failed or timed out
+
+private:
+  // The answer arrives on the lwIP thread and is handed over through this
+  struct Result {
+    volatile bool done;
+    volatile uint32_t address;  // 0 if the lookup failed
+  };
+
+  const char* hostname;
+  IPAddress address;           // Last known good
+  bool valid;                  // address was ever resolved
+  bool expired;                // address must be looked up again before it counts as fresh
+  unsigned long resolvedAt;    // millis() of the last good answer
+  bool resolving;
+  unsigned long lookupStart;
+  Result result;
+
+  uint32_t hits;
+  uint32_t misses;
+  uint32_t stale;
+  uint32_t lookups;
+  uint32_t failures;
+
+  void startLookup(unsigned long now);
+  void resolved(uint32_t address, unsigned long now);
+  void failed();
+
+  static void dnsFound(const char* name, const ip_addr_t* ipaddr, void* arg);
+};
+
+#endif // DNSCACHE_H
@@ -20,8 +20,15 @@
 
 #include <Arduino.h>
 #include <ETH.h>
-#include <WiFiClient.h>
 #include "config.h"
+#include "RingBuffer.h"
+#include "SocketUtil.h"
+#include "SlotSet.h"
+#include "TimerWheel.h"
+#include "LogSink.h"
+#include "FrameParser.h"
+#include "ProxyStatus.h"
+#include "DnsCache.h"
 
 // LED Configuration
 // LED disabled - no LED connected to any GPIO pins
@@ -30,15 +37,34 @@
 #define LED_PIN 12                // Not used when ENABLE_LED is false
 #define LED_BLINK_DURATION 200    // ms to keep LED on when packet received
 
+// One master behind the proxy: clients of uniqueId in the cloud are sent to it
+struct RouteConfig {
+  char uniqueId[64];      // Unique ID we register with the cloud server
+  char masterAddress[16]; // Local master IP address
+  uint16_t masterPort;    // Local master port
+};
+
 // Configuration structure
 struct ProxyConfig {
   char cloudServer[64];   // Cloud server address
   uint16_t cloudPort;     // Cloud server port
-  char masterAddress[16]; // Local master IP address
-  uint16_t masterPort;    // Local master port
-  char uniqueId[64];      // Unique ID for the device
+  RouteConfig routes[MAX_ROUTES];  // routes[0] is the main master
+  uint8_t routeCount;     // Routes in use (routes[0..routeCount)), at least 1
   bool debug;             // Debug mode
   
+  // TCP options of the connections to the cloud server and to the masters
+  SocketProfile cloudSocket;
+  SocketProfile deviceSocket;
+  
+  // Connection slots, allocated once by begin() (changes need a restart)
+  uint16_t capacity;      // Slots for free connections and clients together, at most MAX_CONNECTIONS
+  uint16_t bufferSize;    // Forwarding buffer per direction per slot, in bytes
+  
+  // Warm pool of free connections, per route
+  uint16_t poolMinFree;   // Always keep at least this many free connections
+  uint16_t poolMaxFree;   // Never keep more than this many free connections
+  uint16_t preconnect;    // Free connections with a master socket opened in advance (0 = off)
+  
   // Network configuration
   bool useDHCP;           // Use DHCP (true) or static IP (false)
   char staticIP[16];      // Static IP address
@@ -50,55 +76,124 @@ struct ProxyConfig {
 // Forward declaration
 class ESPProxy;
 
-// Connection direction for logging
-enum ConnectionDirection {
-  FROM_CLOUD,       // [CLOUD -> PROXY]
-  TO_DEVICE,        // [PROXY -> DEVICE]
-  TO_CLOUD,         // [PROXY -> CLOUD]
-  DEVICE_TO_CLOUD,  // [DEVICE -> CLOUD]
-  CLOUD_TO_DEVICE   // [CLOUD -> DEVICE]
+// State of the (single) cloud connection being set up
+// Driven from ESPProxy::loop(), none of the states ever block
+enum CloudConnectState {
+  CLOUD_IDLE,         // Nothing in progress (maybe waiting for the backoff timer)
+  CLOUD_RESOLVING,    // Waiting for the DNS answer for the cloud server
+  CLOUD_CONNECTING,   // Non-blocking TCP connect in progress
+  CLOUD_REGISTERING,  // Sending the [uniqueId] of the route
+  CLOUD_READY         // Registered - about to hand the socket to a new Context
+};
+
+// Why a connection was given up on its timer (see TimerWheel.h)
+enum TimeoutKind {
+  TIMEOUT_CONNECT,    // The master didn't accept the connection in time
+  TIMEOUT_HEARTBEAT,  // Free connection: no heartbeat from the cloud
+  TIMEOUT_IDLE        // Client attached: no data from either side
 };
 
 // Connection context - manages one cloud-to-device connection pair
+//
+// The contexts live in a slab allocated once by ESPProxy (one per slot) and
+// are reused in place: open() hands it a registered cloud socket, cleanupSockets()
+// makes it empty again. Both sides are plain socket fds, so setting up or
+// tearing down a connection never touches the heap.
+// Every change that makes it (no longer) free is reported to
+// ESPProxy::slotChanged(), which keeps the free set up to date.
 class Context {
 public:
-  Context(WiFiClient* cloudSocket, ESPProxy* proxy, int connectionId);
+  Context();
   ~Context();
   
-  void loop();  // Must be called regularly to handle data transfer
-  bool isActive() const { return cloudSocket != nullptr; }
-  bool isFree() const { return cloudSocket != nullptr && deviceSocket == nullptr && cloudConnected; }
+  void attachBuffers(uint8_t* storage, size_t bufferSize);  // Once at startup: 2 x bufferSize bytes to forward through
+  void open(int slot, int cloudFd, ESPProxy* proxy, int connectionId, int route);  // Take over a registered cloud socket
+  
+  // Driven by ESPProxy::loop(): watch() registers the sockets we wait for,
+  // loop() handles them once select() says they are ready (or our timer is due)
+  void watch(SocketSet& io) const;
+  bool isReady(const SocketSet& io) const;
+  unsigned long msUntilTimer(unsigned long now) const;  // Until our next deadline, NO_TIMER if none
+  void loop(const SocketSet& io);
+  
+  bool isActive() const { return cloudFd >= 0; }
+  bool isFree() const { return cloudFd >= 0 && deviceFd < 0 && cloudConnected; }
   
   // Getters for connection details
   int getConnectionId() const { return connectionId; }
-  bool hasCloudSocket() const { return cloudSocket != nullptr; }
-  bool hasDeviceSocket() const { return deviceSocket != nullptr; }
+  int getSlot() const { return slot; }
+  int getRoute() const { return route; }  // Index in ProxyConfig::routes: the master we forward to
+  bool hasCloudSocket() const { return cloudFd >= 0; }
+  bool hasDeviceSocket() const { return deviceConnected; }
   bool isCloudConnected() const { return cloudConnected; }
   bool isDeviceConnected() const { return deviceConnected; }
+  bool isDeviceConnecting() const { return deviceFd >= 0 && !deviceConnected; }
+  bool hasWarmSocket() const { return warmFd >= 0; }  // Pre-connected (or pre-connecting) to the master
+  size_t getCloudToDeviceQueued() const { return cloudToDevice.size(); }
+  size_t getDeviceToCloudQueued() const { return deviceToCloud.size(); }
+  
+  // Traffic accounting
+  const Traffic& getTrafficToDevice() const { return toDevice; }
+  const Traffic& getTrafficToCloud() const { return toCloud; }
+  unsigned long getCreatedAt() const { return createdAt; }
+  unsigned long getDeviceAttachedAt() const { return deviceAttachedAt; }  // 0 if no device connection
+  unsigned long getLastActivity() const { return lastActivity; }
   
   void cleanupSockets();
-  void handleDataFromCloud();
+  bool handleDataFromCloud();  // false when the cloud closed the connection
+  void preconnect();           // Free context: open the master socket before a client arrives
   
 private:
   ESPProxy* proxy;  // Reference to parent ESPProxy instance
   
-  WiFiClient* cloudSocket;
-  WiFiClient* deviceSocket;
+  int cloudFd;   // Registered cloud socket, -1 when the slot is empty
+  int deviceFd;  // Device socket (connecting or connected), -1 if no client attached
   
   int connectionId;  // Unique ID for debugging
+  int slot;          // Index in ESPProxy's slab
+  int route;         // Registered under config.routes[route].uniqueId
   
   bool cloudConnected;
-  bool deviceConnected;
+  bool deviceConnected;              // false while the device connect is still in progress
+  unsigned long deviceConnectStart;  // millis() when the device connect was started
+  
+  // Master socket opened while we are free (see preconnect()), becomes deviceFd when a client arrives
+  int warmFd;
+  bool warmConnected;
+  unsigned long warmConnectStart;
+  
+  // Time to first byte: from the first client data to its first byte sent to the master
+  uint32_t clientStart;  // micros()
+  bool ttfbPending;
+  bool ttfbWarm;         // The client got a pre-connected socket
+  
+  // Data read from one side, waiting until the other side accepts it
+  // cloudToDevice also holds what the client sends while we connect to the device
+  RingBuffer cloudToDevice;
+  RingBuffer deviceToCloud;
+  
+  FrameParser cloudFrames;  // Control frames from the cloud while we are free
+  
+  Traffic toDevice;                // Forwarded cloud -> device
+  Traffic toCloud;                 // Forwarded device -> cloud
+  LatencyTracker toDeviceLatency;  // Queue times of the data in cloudToDevice
+  LatencyTracker toCloudLatency;   // and in deviceToCloud
+  unsigned long createdAt;         // millis() when the cloud connection was handed to us
+  unsigned long deviceAttachedAt;  // millis() when the device connection was made, 0 if none
+  unsigned long lastActivity;      // millis() when data was last received on either side
   
   unsigned long ledOnTime;  // Time when LED was turned on
   bool ledState;            // Current LED state
   
-  void setupCloudSocket();
-  void makeDeviceConnection(uint8_t* data, size_t len);
-  void setUpDeviceSocket();
-  
-  bool isHeartbeatRequest(const char* data, size_t len);
-  bool isConnectionResponse(const char* data, size_t len);
+  void makeDeviceConnection(const uint8_t* data, size_t len);
+  void checkDeviceConnection();
+  void checkWarmConnection(const SocketSet& io);
+  void closeWarmSocket();
+  bool handleDataFromDevice();  // false when the device closed the connection
+  bool receiveData(ConnectionDirection direction);  // Data phase, false when the sender closed the connection
+  bool flushBuffer(ConnectionDirection direction);  // false if the socket is broken
+  void countTraffic(ConnectionDirection direction, size_t len);
+  unsigned long idleTimeout() const;  // Silence after which the peer is considered gone, 0 = none
   
   void blinkLED();     // Turn on LED briefly
   void updateLED();    // Update LED state (turn off after blink duration)
@@ -115,34 +210,56 @@ public:
   ~ESPProxy();
   
   bool begin(const ProxyConfig& config);
-  void loop();  // Must be called regularly in Arduino loop()
+  bool start();  // Run loop() forever in its own task (PROXY_TASK_CORE)
+  void loop();   // One pass of the proxy, waits (select) for socket activity
   
+  // Safe to call from other tasks (web interface)
   void setDebug(bool enabled) { debug = enabled; }
-  void makeNewCloudConnection(int retryCount = 1);  // can be called to create new connection
-  bool hasFreeConnection();                         // check if we have a free connection available
-  
-  // Status getters for web interface
-  int getConnectionCount() const { return connectionCount; }
-  int getFreeConnectionCount() const;
-  int getActiveConnectionCount() const;             // Returns count of connections with device attached
-  int getMaxConnections() const { return MAX_CONNECTIONS; }
-  const ProxyConfig& getConfig() const { return config; }
+  void requestRestart() { restartRequested = true; }   // cleanStart(true) from the proxy task
+  bool getStatus(ProxyStatus& status) const { return snapshot.read(status); }
   
-  // Connection array access (for web interface)
-  Context* getConnection(int index) const { 
-    return (index >= 0 && index < MAX_CONNECTIONS) ? connections[index] : nullptr; 
+  // Proxy task only
+  void makeNewCloudConnection(int route);           // request a new connection, set up asynchronously by loop()
+  bool hasFreeConnection(int route) const { return !routes[route].slots.intersect(freeSlots).isEmpty(); }
+  bool isCloudConnectPending(int route) const {
+    return routes[route].connectWanted || (cloudState != CLOUD_IDLE && cloudRoute == route);
   }
   
+  // Status getters (the web interface uses getStatus() instead)
+  int getConnectionCount() const { return usedSlots.count(); }
+  int getFreeConnectionCount() const { return freeSlots.count(); }
+  int getActiveConnectionCount() const { return usedSlots.without(freeSlots).count(); }  // connections with a client attached
+  int getFreeConnectionCount(int route) const { return routes[route].slots.intersect(freeSlots).count(); }
+  int getMaxConnections() const { return capacity; }
+  CloudConnectState getCloudConnectState() const { return cloudState; }
+  const ProxyConfig& getConfig() const { return config; }
+  
   // Statistics getters
-  unsigned long getTotalBytesTransferred() const { return totalBytesTransferred; }
-  unsigned long getTotalClientConnections() const { return totalClientConnections; }
+  uint64_t getTotalBytesTransferred() const { return totalToDevice.bytes + totalToCloud.bytes; }
+  uint64_t getTotalClientConnections() const { return totalClientConnections; }
   
   // Statistics updaters (called by Context)
-  void addBytesTransferred(size_t bytes) { totalBytesTransferred += bytes; }
-  void incrementClientConnections() { totalClientConnections++; }
+  void addTraffic(int route, ConnectionDirection direction, size_t len) {
+    (direction == CLOUD_TO_DEVICE ? totalToDevice : totalToCloud).add(len);
+    (direction == CLOUD_TO_DEVICE ? routes[route].toDevice : routes[route].toCloud).add(len);
+  }
+  LatencyHistogram& getLatency(ConnectionDirection direction) {
+    return (direction == CLOUD_TO_DEVICE) ? latencyToDevice : latencyToCloud;
+  }
+  void addForwardTime(bool receive, uint32_t us) {
+    (receive ? forwardRecvCalls : forwardSendCalls)++;
+    forwardMicros += us;
+  }
+  void recordFirstByte(bool warm, uint32_t us) { (warm ? ttfbWarm : ttfbCold).record(us); }
+  void preconnectUsed() { preconnectHits++; }
+  void preconnectLost();                // A pre-connect failed or the master closed it
+  void connectionTimedOut(TimeoutKind kind);
+  void clientAttached(int route);       // A free connection of route was just taken by a client
   void removeConnection(Context* ctx);  // Called by Context when connection closes
+  void slotChanged(int slot);           // Called by Context when it may have become (un)free
 
-  // Logging functions
+  // Logging functions, safe from any task and never blocking:
+  // they only queue a record, the log task prints it (see LogSink.h)
   void logDebug(const char* msg);
   void logInfo(const char* msg);
   void logError(const char* msg);  
@@ -151,28 +268,121 @@ public:
   // Generic logging helper: logs [SOURCE] -> [DEST] messages
   // connectionId: if > 0, includes "(conn #X)" in message
   // extraStr: if not nullptr, appends this string to the message
-  void logDirection(ConnectionDirection direction);
   void logMessage(ConnectionDirection direction, int connectionId, 
                   const char* message, const char* extraStr = nullptr);
+  uint32_t getLogDropped() const { return logSink.getDropped(); }
 
   // Restart the ESP, but try to clean up first
   void cleanStart(bool restart = false);
+  
+  bool isInOutage() const { return outageSince != 0; }  // No connections at all, being rebuilt
 
 private:
   ProxyConfig config;
-  bool debug;
+  volatile bool debug;
+  volatile bool restartRequested;
+  LogSink logSink;
   
-  Context* connections[MAX_CONNECTIONS];
-  int connectionCount;  // Number of active connections in array
+  // All contexts, allocated once by allocateSlots() and reused in place
+  Context* slab;                 // capacity contexts, in internal RAM: the loop touches them all the time
+  uint8_t* slabBuffers;          // Their forwarding buffers, 2 x bufferSize per slot
+  bool buffersInPsram;
+  int capacity;                  // Slots allocated (config.capacity)
+  SlotSet usedSlots;             // Slots holding a connection
+  SlotSet freeSlots;             // Used slots waiting for a client (Context::isFree())
   int nextConnectionId; // Counter for generating unique connection IDs
   
   unsigned long lastConnectionCheck;
   
+  SocketSet io;       // Sockets loop() waits on
+  TimerWheel timers;  // Next deadline of every used slot (Context::msUntilTimer())
+  
+  // Status published for the web task
+  StatusSnapshot snapshot;
+  ProxyStatus status;            // Scratch copy, filled by publishStatus()
+  unsigned long lastStatusPublish;
+  
   // Statistics
-  unsigned long totalBytesTransferred;
-  unsigned long totalClientConnections;
+  Traffic totalToDevice;
+  Traffic totalToCloud;
+  LatencyHistogram latencyToDevice;  // From read to sent, per direction, since boot
+  LatencyHistogram latencyToCloud;
+  uint64_t totalClientConnections;
+  uint32_t connectTimeouts;         // Connections given up on their timer, see TimeoutKind
+  uint32_t heartbeatTimeouts;
+  uint32_t idleTimeouts;
+  
+  // Outages: no connection left, see removeConnection() and checkOutage()
+  unsigned long outageSince;        // millis() when the last connection was gone, 0 if we have some
+  uint32_t outages;
+  uint32_t lastRecoveryMs;          // Time to recover: until the first new free connection
+  uint32_t maxRecoveryMs;
+  uint64_t totalRecoveryMs;
+  
+  // Time spent in the socket calls that forward data (see FORWARD_DIRECT_RECV)
+  uint64_t forwardMicros;
+  uint32_t forwardRecvCalls;
+  uint32_t forwardSendCalls;
+  
+  // Pre-connect - see maintainPreconnect()
+  LatencyHistogram ttfbWarm;        // First client byte to the master: with a pre-connected socket
+  LatencyHistogram ttfbCold;        // ... and with a connect after the client arrived
+  uint32_t preconnectStarted;
+  uint32_t preconnectHits;          // Clients that got a pre-connected socket
+  uint32_t preconnectDropped;       // Failed, timed out or closed by the master
+  unsigned long preconnectRetryAt;  // millis() before which no new pre-connect is started
+  
+  // Per route: its connections, warm pool (see maintainPool()) and statistics
+  struct Route {
+    SlotSet slots;                    // Used slots registered for this route
+    bool connectWanted;               // A new free connection was asked for
+    int poolTarget;                   // Free connections we try to keep ready
+    float arrivalRate;                // Clients per second (moving average)
+    int arrivalsInWindow;             // Clients since arrivalWindowStart
+    unsigned long arrivalWindowStart;
+    unsigned long poolHits;           // Client attached and another free connection was still ready
+    unsigned long poolMisses;         // Client took the last free connection
+    uint64_t clientConnections;
+    Traffic toDevice;
+    Traffic toCloud;
+  };
+  Route routes[MAX_ROUTES];
+  
+
+  uint32_t minLargestFreeBlock;     // Fragmentation telemetry, see publishStatus()
+  
+  // Cloud connection setup - see CloudConnectState
+  CloudConnectState cloudState;
+  int cloudRoute;                   // Route of the connection being set up
+  int cloudFd;                      // Socket being connected / registered (-1 if none)
+  IPAddress cloudIP;                // Address of the cloud server for this attempt
+  DnsCache cloudDns;                // Cloud server address, looked up in the background
+  unsigned long cloudStateSince;    // millis() when we entered the current state
+  unsigned long cloudNextAttempt;   // millis() before which we don't retry (backoff)
+  int cloudRetryCount;              // Consecutive failures, drives the backoff
+  uint32_t cloudAttempts;           // Statistics: attempts and failures since boot
+  uint32_t cloudFailures;
+  char cloudRegistration[sizeof(RouteConfig::uniqueId) + 2];  // "[uniqueId]"
+  size_t cloudRegistrationLen;
+  size_t cloudRegistrationSent;
   
+  static void proxyTask(void* arg);
+  bool allocateSlots();
   void checkConnections();
+  void maintainPool(unsigned long now);
+  void maintainPool(int route, unsigned long now);
+  int nextWantedRoute() const;      // Route to make the next cloud connection for, -1 if none
+  void maintainPreconnect(unsigned long now);
+  void outageStarted();
+  void checkOutage(unsigned long now);   // Recovered, or restart when it takes too long
+  void publishStatus();
+  void scheduleTimer(int slot);     // After the context in slot may have changed its deadline
+  unsigned long msUntilTimer(unsigned long now) const;  // How long loop() may sleep
+  void driveCloudConnection();      // Advance the cloud connect state machine
+  void startCloudConnect();
+  void setCloudState(CloudConnectState state);
+  void cloudConnectFailed(const char* reason);
+  void closeCloudAttempt();
 };
 
 #endif // ESPPROXY_H
@@ -0,0 +1,66 @@
+/*
+ * Parser for the messages on a free cloud connection
+ *
+ * While no client is attached, the cloud only sends control frames:
+ * heartbeats ([215,3]) and answers to our registration ([OK...] or
+ * [ERROR...]). Anything else is the first message of a client. TCP doesn't
+ * keep message boundaries, so one read can hold two heartbeats, or half of
+ * one. The parser follows the [ ... ] frames across reads, on the read
+ * buffer itself: only the start of the current frame (at most
+ * FRAME_PREFIX_SIZE bytes) is kept between reads.
+ *
+ * Spaces and line ends after a control frame are skipped; anywhere else
+ * they are client data, like every other byte that doesn't start a frame.
+ *
+ * Author: Johan Coppieters for Duotecno
+ * Date: November 2025
+ */
+
+#ifndef FRAMEPARSER_H
+#define FRAMEPARSER_H
+
+#include <Arduino.h>
+
+// Longest frame start needed to tell control frames from client data ("[215,3]")
+#define FRAME_PREFIX_SIZE 8
+
+enum FrameType {
+  FRAME_NONE,       // All data consumed, waiting for more
+  FRAME_HEARTBEAT,  // [215,3] - answer with [72,3]
+  FRAME_RESPONSE,   // [OK...] or [ERROR...] - answer to our registration
+  FRAME_CLIENT      // A client is talking: prefix() + the rest of the data is for the device
+};
+
+class FrameParser {
+public:
+  FrameParser() { this->reset(); }
+
+  void reset();
+
+  // Parse data[pos..len), pos is moved past what was used
+  // Call again until it returns FRAME_NONE (pos == len) or FRAME_CLIENT,
+  // after FRAME_CLIENT the parser is done: prefix() and data[pos..len) go to the device
+  FrameType next(const uint8_t* data, size_t len, size_t& pos);
+
+  // Start of the current (or last) frame, 0-terminated
+  const char* prefix() const { return held; }
+  size_t prefixLength() const { return heldLen; }
+
+  // Index of the first c in data[0..len), len if there is none
+  // Compares a 32 bit word (4 bytes) per step
+  static size_t findByte(const uint8_t* data, size_t len, uint8_t c);
+
+private:
+  enum State {
+    OUTSIDE,   // Between frames
+    PREFIX,    // Reading the start of a frame, not classified yet
+    RESPONSE   // Inside a response frame, skipping to its ']'
+  };
+
+  State state;
+  bool afterFrame;  // A control frame was seen: skip the line end that may follow it
+  char held[FRAME_PREFIX_SIZE + 1];
+  size_t heldLen;
+};
+
+#endif // FRAMEPARSER_H
@@ -0,0 +1,154 @@
+/*
+ * Forwarding latency: how long data waits in the proxy
+ *
+ * LatencyTracker follows the data in one RingBuffer: it remembers when each
+ * chunk was queued, and when the last byte of a chunk has been sent it
+ * records the time in between in a LatencyHistogram.
+ *
+ * LatencyHistogram uses log-linear buckets (like HdrHistogram): 8 buckets
+ * per power of 2, so every value is known within 12.5%, from 1 us up to
+ * ~71 minutes, in a fixed 240 counters.
+ *
+ * Author: Johan Coppieters for Duotecno
+ * Date: November 2025
+ */
+
+#ifndef LATENCYHISTOGRAM_H
+#define LATENCYHISTOGRAM_H
+
+#include <Arduino.h>
+#include "config.h"
+
+// Percentiles as published for the web interface (us)
+struct LatencySummary {
+  uint32_t count;
+  uint64_t sum;
+  uint32_t p50;
+  uint32_t p90;
+  uint32_t p99;
+  uint32_t max;
+};
+
+class LatencyHistogram {
+public:
+  LatencyHistogram() { this->clear(); }
+
+  void clear() {
+    memset(counts, 0, sizeof(counts));
+    total = 0;
+    sumValue = 0;
+    maxValue = 0;
+  }
+
+  void record(uint32_t us) {
+    counts[bucketOf(us)]++;
+    total++;
+    sumValue += us;
+    if (us > maxValue) maxValue = us;
+  }
+
+  uint32_t count() const { return total; }
+  uint32_t max() const { return maxValue; }
+
+  // Smallest value that at least fraction (0..1) of the samples don't exceed
+  // (upper end of its bucket, never more than the real maximum)
+  uint32_t percentile(float fraction) const {
+    if (total == 0) return 0;
+    uint32_t wanted = (uint32_t)ceilf(fraction * total);
+    if (wanted == 0) wanted = 1;
+
+    uint32_t seen = 0;
+    for (int i = 0; i < BUCKETS; i++) {
+      seen += counts[i];
+      if (seen >= wanted) return min(bucketTop(i), maxValue);
+    }
+    return maxValue;
+  }
+
+  void summarize(LatencySummary& summary) const {
+    summary.count = total;
+    summary.sum = sumValue;
+    summary.p50 = percentile(0.50f);
+    summary.p90 = percentile(0.90f);
+    summary.p99 = percentile(0.99f);
+    summary.max = maxValue;
+  }
+
+private:
+  static const int SUB_BITS = 3;                // 8 buckets per power of 2
+  static const int SUB = 1 << SUB_BITS;
+  static const int BUCKETS = (32 - SUB_BITS + 1) * SUB;
+
+  // Values below 2 * SUB have a bucket each, above that the 3 bits
+  // after the highest set bit pick one of the SUB buckets of its power of 2
+  static int bucketOf(uint32_t v) {
+    if (v < 2 * SUB) return v;
+    int shift = (31 - __builtin_clz(v)) - SUB_BITS;
+    return (shift + 1) * SUB + (int)((v >> shift) - SUB);
+  }
+
+  static uint32_t bucketTop(int bucket) {
+    if (bucket < 2 * SUB) return bucket;
+    int shift = bucket / SUB - 1;
+    uint32_t low = (uint32_t)(bucket % SUB + SUB) << shift;
+    return low + ((1UL << shift) - 1);
+  }
+
+  uint32_t counts[BUCKETS];
+  uint32_t total;
+  uint64_t sumValue;  // For the Prometheus summaries (_sum)
+  uint32_t maxValue;
+};
+
+class LatencyTracker {
+public:
+  LatencyTracker() { this->clear(); }
+
+  void clear() {
+    head = 0;
+    marks = 0;
+    queuedBytes = 0;
+    sentBytes = 0;
+  }
+
+  // len bytes were written to the ring at time now (us)
+  void queued(size_t len, uint32_t now) {
+    queuedBytes += len;
+    if (marks == LATENCY_MARKS) {
+      // No room: the newest chunk absorbs these bytes (measured from its, earlier, time)
+      mark[(head + marks - 1) % LATENCY_MARKS].end = queuedBytes;
+      return;
+    }
+    Mark& m = mark[(head + marks) % LATENCY_MARKS];
+    m.end = queuedBytes;
+    m.time = now;
+    marks++;
+  }
+
+  // Bytes written to the ring that are not forwarded data (heartbeat answers)
+  void queuedUntimed(size_t len) { queuedBytes += len; }
+
+  // len bytes left the ring at time now (us): record every chunk that is now completely sent
+  void sent(size_t len, uint32_t now, LatencyHistogram& histogram) {
+    sentBytes += len;
+    while (marks > 0 && (int32_t)(sentBytes - mark[head].end) >= 0) {
+      histogram.record(now - mark[head].time);
+      head = (head + 1) % LATENCY_MARKS;
+      marks--;
+    }
+  }
+
+private:
+  struct Mark {
+    uint32_t end;   // queuedBytes after this chunk
+    uint32_t time;  // micros() when it was queued
+  };
+
+  Mark mark[LATENCY_MARKS];
+  uint8_t head;
+  uint8_t marks;
+  uint32_t queuedBytes;  // Total written to the ring (wraps, only differences count)
+  uint32_t sentBytes;    // Total sent from the ring
+};
+
+#endif // LATENCYHISTOGRAM_H
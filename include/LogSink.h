@@ -0,0 +1,89 @@
+/*
+ * Asynchronous log output
+ *
+ * Writing to Serial blocks until the UART has sent the bytes: at 115200 baud
+ * a forwarded 512 byte chunk in debug mode held up the proxy for ~45 ms.
+ * The proxy therefore only drops a small binary record in a lock-free ring
+ * (a few hundred nanoseconds), a low priority task on the other core
+ * formats and prints them. When that task can't keep up, new records are
+ * dropped and counted - logging never slows down the forwarding.
+ *
+ * The ring is a bounded multi-producer queue (Vyukov): every cell carries a
+ * sequence number that tells producers and the consumer whose turn it is,
+ * so no locks are needed and any task may log.
+ *
+ * Author: Johan Coppieters for Duotecno
+ * Date: November 2025
+ */
+
+#ifndef LOGSINK_H
+#define LOGSINK_H
+
+#include <Arduino.h>
+#include <atomic>
+#include "config.h"
+
+static_assert((LOG_RING_SIZE & (LOG_RING_SIZE - 1)) == 0, "LOG_RING_SIZE must be a power of 2");
+
+// Connection direction for logging
+enum ConnectionDirection {
+  FROM_CLOUD,       // [CLOUD -> PROXY]
+  TO_DEVICE,        // [PROXY -> DEVICE]
+  TO_CLOUD,         // [PROXY -> CLOUD]
+  DEVICE_TO_CLOUD,  // [DEVICE -> CLOUD]
+  CLOUD_TO_DEVICE   // [CLOUD -> DEVICE]
+};
+
+enum LogLevel {
+  LOG_DEBUG,    // [DEBUG] text
+  LOG_INFO,     // [INFO] text
+  LOG_ERROR,    // [ERROR] **** text ****
+  LOG_MESSAGE,  // [SOURCE -> DEST] conn #X: text
+  LOG_DATA      // [SOURCE -> DEST] conn #X: Forwarding N bytes: payload
+};
+
+struct LogRecord {
+  uint32_t time;          // millis() when it was logged
+  uint8_t level;          // LogLevel
+  uint8_t direction;      // ConnectionDirection (LOG_MESSAGE and LOG_DATA)
+  uint16_t length;        // LOG_DATA: bytes forwarded (text holds only the first LOG_TEXT_SIZE)
+  int32_t connectionId;   // 0: not about a connection
+  char text[LOG_TEXT_SIZE];  // Message (0-terminated) or start of the payload
+};
+
+class LogSink {
+public:
+  LogSink();
+
+  bool start();  // Start the task that prints the records (LOG_TASK_CORE)
+
+  // Any task, never block: false (and counted) when the ring is full
+  bool write(LogLevel level, const char* text, const char* extra = nullptr,
+             ConnectionDirection direction = FROM_CLOUD, int connectionId = 0);
+  bool writeData(ConnectionDirection direction, int connectionId, const uint8_t* data, size_t len);
+
+  uint32_t getDropped() const { return dropped.load(std::memory_order_relaxed); }
+
+private:
+  struct Cell {
+    std::atomic<uint32_t> sequence;
+    LogRecord record;
+  };
+
+  Cell cells[LOG_RING_SIZE];
+  std::atomic<uint32_t> enqueuePos;
+  std::atomic<uint32_t> dequeuePos;
+  std::atomic<uint32_t> dropped;
+  uint32_t droppedReported;  // Drain task only
+  bool started;
+
+  Cell* claim(uint32_t& pos);           // Reserve a cell to fill, nullptr when full
+  void commit(Cell* cell, uint32_t pos);
+  bool read(LogRecord& record);         // Drain task only, false when empty
+  void print(const LogRecord& record);
+
+  static void drainTask(void* arg);
+  static void printDirection(uint8_t direction);
+};
+
+#endif // LOGSINK_H
@@ -0,0 +1,33 @@
+/*
+ * Internal RAM and PSRAM
+ *
+ * The ESP32 has a few hundred KB of internal RAM, fast but shared with the
+ * network stack, and some boards add a few MB of PSRAM behind the cache:
+ * slower, but plenty for bulk data. The connection contexts, which the proxy
+ * loop touches all the time, go in internal RAM. Their forwarding buffers,
+ * which are only copied in and out of, can go in PSRAM.
+ *
+ * Built for a host both are plain malloc().
+ *
+ * Author: Johan Coppieters for Duotecno
+ * Date: November 2025
+ */
+
+#ifndef MEMORYUTIL_H
+#define MEMORYUTIL_H
+
+#include <Arduino.h>
+
+// Internal RAM, nullptr if there isn't enough
+void* allocInternal(size_t size);
+
+// PSRAM if the board has it (and it fits), internal RAM otherwise - inPsram tells which
+void* allocBulk(size_t size, bool& inPsram);
+
+void freeMemory(void* memory);
+
+// PSRAM of the board, 0 if it has none
+uint32_t psramSize();
+uint32_t psramFree();
+
+#endif // MEMORYUTIL_H
@@ -0,0 +1,175 @@
+/*
+ * Proxy statistics as seen by the web interface
+ *
+ * The proxy runs in its own task (core 1) and the web server in another
+ * (core 0). Instead of letting the web side walk the live connection
+ * slots, the proxy task regularly publishes a copy of its state here.
+ * StatusSnapshot is a seqlock: the writer never waits, a reader simply
+ * retries when it raced with a publish.
+ *
+ * Author: Johan Coppieters for Duotecno
+ * Date: November 2025
+ */
+
+#ifndef PROXYSTATUS_H
+#define PROXYSTATUS_H
+
+#include <Arduino.h>
+#include <atomic>
+#include "config.h"
+#include "TaskUtil.h"
+#include "LatencyHistogram.h"
+
+// Data forwarded in one direction (64 bit: a busy site passes 4 GiB in weeks)
+struct Traffic {
+  uint64_t bytes;
+  uint64_t chunks;   // Reads forwarded
+  
+  void clear() { bytes = 0; chunks = 0; }
+  void add(size_t len) { bytes += len; chunks++; }
+};
+
+// One connection slot
+struct SlotStatus {
+  bool used;               // false: empty slot, other fields are meaningless
+  int id;                  // Connection id (for debugging)
+  int route;               // Master it was registered for (ProxyConfig::routes)
+  bool free;               // Waiting for a client
+  bool cloudSocket;
+  bool cloudConnected;
+  bool deviceSocket;
+  bool deviceConnected;
+  bool deviceConnecting;
+  bool deviceWarm;         // Free, with a pre-connected master socket
+  uint32_t cloudToDevice;  // Bytes queued per direction
+  uint32_t deviceToCloud;
+  Traffic toDevice;        // Forwarded per direction since the connection was made
+  Traffic toCloud;
+  uint32_t ageMs;          // Since the cloud connection was registered
+  uint32_t attachedMs;     // Since the device connection was made, 0 if none
+  uint32_t idleMs;         // Since data was last received on either side
+};
+
+// One master (route), see ProxyConfig::routes
+struct RouteStatus {
+  int freeConnections;
+  int activeConnections;
+  int poolTarget;
+  float arrivalRate;       // Clients per second
+  unsigned long poolHits;
+  unsigned long poolMisses;
+  uint64_t clientConnections;
+  Traffic toDevice;
+  Traffic toCloud;
+};
+
+struct ProxyStatus {
+  int connectionCount;     // Used slots
+  int freeConnections;
+  int activeConnections;   // Connections with a client attached
+  int cloudState;          // CloudConnectState of the connection being set up
+  uint32_t cloudAttempts;  // Cloud connections started since boot
+  uint32_t cloudFailures;  // ... and how many of them failed
+  uint32_t dnsHits;        // Cloud address from the cache (see DnsCache)
+  uint32_t dnsMisses;      // ... not cached yet, waited for a lookup
+  uint32_t dnsStale;       // ... expired, last known good used
+  uint32_t dnsLookups;
+  uint32_t dnsFailures;
+  uint64_t bytesTransferred;
+  uint64_t clientConnections;
+  Traffic toDevice;        // All connections together
+  Traffic toCloud;
+  LatencySummary latencyToDevice;  // Time data waits in the proxy (us)
+  LatencySummary latencyToCloud;
+  
+  // Connections given up on their timer (see TimeoutKind)
+  uint32_t connectTimeouts;
+  uint32_t heartbeatTimeouts;
+  uint32_t idleTimeouts;
+  
+  // Outages: all connections lost and rebuilt
+  uint32_t outages;
+  uint32_t outageMs;       // Current outage, 0 if none
+  uint32_t lastRecoveryMs;
+  uint32_t maxRecoveryMs;
+  uint64_t totalRecoveryMs;
+  
+  // Forwarding cost: time in the receive/send calls of the data phase
+  uint64_t forwardMicros;
+  uint32_t forwardRecvCalls;
+  uint32_t forwardSendCalls;
+  
+  // Pre-connected master sockets (see ProxyConfig::preconnect)
+  int preconnectBudget;
+  int preconnectOpen;              // Free connections holding one now
+  uint32_t preconnectStarted;
+  uint32_t preconnectUsed;         // Clients that found one
+  uint32_t preconnectDropped;      // Failed, timed out or closed by the master
+  LatencySummary ttfbWarm;         // First client data to the master (us), pre-connected...
+  LatencySummary ttfbCold;         // ... and connected when the client arrived
+  
+  // Warm pool, all routes together
+  int poolTarget;
+  float arrivalRate;       // Clients per second
+  unsigned long poolHits;
+  unsigned long poolMisses;
+  
+  int routeCount;
+  RouteStatus routes[MAX_ROUTES];
+  
+  // Heap - the largest free block going down over time means fragmentation
+  uint32_t freeHeap;
+  uint32_t minFreeHeap;          // Lowest free heap since boot
+  uint32_t largestFreeBlock;
+  uint32_t minLargestFreeBlock;  // Lowest largest free block since boot
+  uint32_t psramSize;            // 0 if the board has none
+  uint32_t psramFree;
+  
+  // Connection slots, allocated at startup
+  int capacity;                  // slots[0..capacity) are filled in
+  uint32_t bufferSize;           // Forwarding buffer per direction
+  uint32_t slotBytes;            // Internal RAM per slot (its Context)
+  uint32_t slotBufferBytes;      // Buffers per slot, in PSRAM if buffersInPsram
+  bool buffersInPsram;
+  uint32_t slabSize;             // Memory of all connection slots, buffers included
+  
+  uint32_t logDropped;           // Log records the log task couldn't keep up with
+  
+  SlotStatus slots[MAX_CONNECTIONS];
+};
+
+class StatusSnapshot {
+public:
+  StatusSnapshot() : sequence(0) { memset(&this->data, 0, sizeof(this->data)); }
+
+  // Proxy task only
+  void publish(const ProxyStatus& status) {
+    uint32_t seq = this->sequence.load(std::memory_order_relaxed);
+    this->sequence.store(seq + 1, std::memory_order_relaxed);  // odd: write in progress
+    std::atomic_thread_fence(std::memory_order_release);
+    memcpy(&this->data, &status, sizeof(ProxyStatus));
+    std::atomic_thread_fence(std::memory_order_release);
+    this->sequence.store(seq + 2, std::memory_order_release);
+  }
+
+  // Any task, returns false if it kept racing with the writer (should not happen)
+  bool read(ProxyStatus& status) const {
+    for (int attempt = 0; attempt < 100; attempt++) {
+      // A writer that got preempted mid-publish needs a moment to finish
+      if (attempt >= 3) taskSleep(1);
+      
+      uint32_t before = this->sequence.load(std::memory_order_acquire);
+      if (before & 1) continue;
+      memcpy(&status, &this->data, sizeof(ProxyStatus));
+      std::atomic_thread_fence(std::memory_order_acquire);
+      if (this->sequence.load(std::memory_order_relaxed) == before) return true;
+    }
+    return false;
+  }
+
+private:
+  ProxyStatus data;
+  std::atomic<uint32_t> sequence;
+};
+
+#endif // PROXYSTATUS_H
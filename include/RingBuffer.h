@@ -0,0 +1,95 @@
+/*
+ * Fixed-size byte ring buffer
+ *
+ * One of these sits in each direction of a Context: data read from one
+ * socket is queued here until the other socket accepts it. When it is full
+ * we simply stop reading, so TCP flow control pushes back to the sender.
+ *
+ * The bytes themselves live elsewhere (ESPProxy allocates the buffers of all
+ * slots in one block at startup, in PSRAM if it can), begin() hands them over.
+ *
+ * Author: Johan Coppieters for Duotecno
+ * Date: November 2025
+ */
+
+#ifndef RINGBUFFER_H
+#define RINGBUFFER_H
+
+#include <Arduino.h>
+
+class RingBuffer {
+public:
+  RingBuffer() : data(nullptr), length(0) { this->clear(); }
+
+  // Queue in the len bytes at storage from now on (empty)
+  void begin(uint8_t* storage, size_t len) { data = storage; length = len; clear(); }
+
+  void clear() { head = 0; count = 0; }
+
+  size_t capacity() const { return length; }
+  size_t size() const { return count; }
+  size_t space() const { return length - count; }
+  bool isEmpty() const { return count == 0; }
+  bool isFull() const { return count == length; }
+
+  // Append as much as fits, returns the number of bytes stored
+  size_t write(const uint8_t* src, size_t len) {
+    size_t stored = 0;
+    while (stored < len && count < length) {
+      size_t tail = (head + count) % length;
+      size_t chunk = min(len - stored, min(length - count, length - tail));
+      memcpy(data + tail, src + stored, chunk);
+      count += chunk;
+      stored += chunk;
+    }
+    return stored;
+  }
+
+  // Free space after the queued bytes that is contiguous in memory (len = 0 when full)
+  // Fill it, then commit() what was stored
+  uint8_t* reserve(size_t& len) {
+    size_t tail = (head + count) % length;
+    len = min(length - count, length - tail);
+    return data + tail;
+  }
+
+  // Free space after the part reserve() returns: at the start of the ring (len = 0 if none)
+  uint8_t* reserveWrapped(size_t& len) {
+    size_t first;
+    this->reserve(first);
+    len = length - count - first;
+    return data;
+  }
+
+  // Queue len bytes that were stored in the reserved space
+  void commit(size_t len) {
+    count += min(len, length - count);
+  }
+
+  // Oldest queued bytes that are contiguous in memory (len = 0 when empty)
+  const uint8_t* peek(size_t& len) const {
+    len = min(count, length - head);
+    return data + head;
+  }
+
+  // Queued bytes after the ones peek() returns: the part that wrapped to the start (len = 0 if none)
+  const uint8_t* peekWrapped(size_t& len) const {
+    len = count - min(count, length - head);
+    return data;
+  }
+
+  // Drop bytes from the front, after they have been sent
+  void consume(size_t len) {
+    len = min(len, count);
+    head = (head + len) % length;
+    count -= len;
+  }
+
+private:
+  uint8_t* data;
+  size_t length;  // Size of data
+  size_t head;    // Index of the oldest byte
+  size_t count;   // Number of bytes queued
+};
+
+#endif // RINGBUFFER_H
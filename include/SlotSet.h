@@ -0,0 +1,59 @@
+/*
+ * Set of connection slots as a bitmap
+ *
+ * ESPProxy keeps one of these for the used slots and one for the free
+ * connections, and updates them when a connection changes state. Asking
+ * for a free connection, counting them or finding an empty slot is then a
+ * single bit operation instead of a walk over all MAX_CONNECTIONS slots.
+ *
+ * Author: Johan Coppieters for Duotecno
+ * Date: November 2025
+ */
+
+#ifndef SLOTSET_H
+#define SLOTSET_H
+
+#include <Arduino.h>
+#include "config.h"
+
+static_assert(MAX_CONNECTIONS <= 64, "MAX_CONNECTIONS can be at most 64 (one bit per slot)");
+
+class SlotSet {
+public:
+  SlotSet() : bits(0) {}
+
+  void clear() { bits = 0; }
+  void add(int slot) { bits |= bit(slot); }
+  void remove(int slot) { bits &= ~bit(slot); }
+  void assign(int slot, bool member) { if (member) add(slot); else remove(slot); }
+
+  bool contains(int slot) const { return (bits & bit(slot)) != 0; }
+  bool isEmpty() const { return bits == 0; }
+  int count() const { return __builtin_popcountll(bits); }
+
+  // Iterate with: for (int i = set.first(); i >= 0; i = set.next(i))
+  int first() const { return bits ? __builtin_ctzll(bits) : -1; }
+  int next(int slot) const {
+    uint64_t rest = (slot >= 63) ? 0 : bits & (~0ULL << (slot + 1));
+    return rest ? __builtin_ctzll(rest) : -1;
+  }
+
+  // Lowest slot < MAX_CONNECTIONS that is not in the set, -1 if all are taken
+  int firstMissing() const {
+    uint64_t missing = ~bits & ALL;
+    return missing ? __builtin_ctzll(missing) : -1;
+  }
+
+  SlotSet without(const SlotSet& other) const { return SlotSet(bits & ~other.bits); }
+  SlotSet intersect(const SlotSet& other) const { return SlotSet(bits & other.bits); }
+
+private:
+  static const uint64_t ALL = (MAX_CONNECTIONS == 64) ? ~0ULL : ((1ULL << (MAX_CONNECTIONS % 64)) - 1);
+
+  explicit SlotSet(uint64_t value) : bits(value) {}
+  static uint64_t bit(int slot) { return 1ULL << slot; }
+
+  uint64_t bits;
+};
+
+#endif // SLOTSET_H
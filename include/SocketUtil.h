@@ -0,0 +1,102 @@
+/*
+ * Small helpers around the lwIP BSD socket API
+ *
+ * Used by the proxy to set up connections and move data without blocking
+ * the main loop: a connect is started here and its progress is polled from
+ * loop(), reads and writes only do what the socket can do right now.
+ *
+ * Only plain BSD socket calls are used, so this also builds on a host
+ * (Linux/macOS) against the system socket headers.
+ *
+ * Author: Johan Coppieters for Duotecno
+ * Date: November 2025
+ */
+
+#ifndef SOCKETUTIL_H
+#define SOCKETUTIL_H
+
+#include <Arduino.h>
+
+#ifdef ARDUINO
+  #include <lwip/sockets.h>
+#else
+  #include <sys/socket.h>
+  #include <sys/select.h>
+  #include <netinet/in.h>
+  #include <netinet/tcp.h>
+  #include <sys/uio.h>
+  #include <fcntl.h>
+  #include <unistd.h>
+#endif
+
+// TCP options for one kind of connection (ProxyConfig::cloudSocket, ProxyConfig::deviceSocket)
+struct SocketProfile {
+  bool noDelay;                // TCP_NODELAY: send at once, don't wait to fill a segment (Nagle)
+  uint16_t keepAliveIdle;      // Seconds without traffic before keepalive probes, 0 = no keepalive
+  uint16_t keepAliveInterval;  // Seconds between probes
+  uint16_t keepAliveCount;     // Unanswered probes before the connection is dropped
+  uint16_t sendBuffer;         // SO_SNDBUF in bytes, 0 = default of the TCP stack
+};
+
+// Start a non-blocking TCP connect, returns the socket fd or -1 on failure
+// The options of profile are set before connecting
+int socketConnectStart(const IPAddress& ip, uint16_t port, const SocketProfile& profile);
+
+// Set the options of profile on a socket (failures are ignored, the defaults still work)
+void socketApplyProfile(int fd, const SocketProfile& profile);
+
+// Poll a connect started with socketConnectStart()
+// returns 1 when connected, 0 while still in progress, -1 when it failed
+int socketConnectCheck(int fd);
+
+// Send without blocking
+// returns the number of bytes accepted (0 if the send buffer is full), -1 on error
+int socketSend(int fd, const uint8_t* data, size_t len);
+
+// Send two pieces (the halves of a wrapped ring buffer) in one call, so they leave as one write
+// returns like socketSend(): bytes accepted from data1 and then data2
+int socketSend(int fd, const uint8_t* data1, size_t len1, const uint8_t* data2, size_t len2);
+
+// Receive without blocking
+// returns the number of bytes read (0 if nothing is waiting), -1 when closed or on error
+int socketRecv(int fd, uint8_t* data, size_t len);
+
+// Receive into two pieces (the free space of a ring buffer) in one call
+// returns like socketRecv(): bytes stored in data1 and then data2
+int socketRecv(int fd, uint8_t* data1, size_t len1, uint8_t* data2, size_t len2);
+
+// Close a socket (every socket of the proxy is closed here), a negative fd is ignored
+void socketClose(int fd);
+
+//
+// The set of sockets the proxy loop waits on with select()
+//
+// Every loop the proxy registers what it is interested in (readable when
+// there is room to queue data, writable when data is queued or a connect is
+// in progress), then sleeps in wait() until one of them is ready or the
+// next timer is due.
+//
+class SocketSet {
+public:
+  SocketSet() { this->clear(); }
+  
+  void clear();
+  void watchRead(int fd);
+  void watchWrite(int fd);
+  
+  // Block until a watched socket is ready or timeoutMs passed
+  // returns the number of ready sockets, 0 on timeout
+  int wait(unsigned long timeoutMs);
+  
+  bool canRead(int fd) const { return fd >= 0 && FD_ISSET(fd, &readyRead); }
+  bool canWrite(int fd) const { return fd >= 0 && FD_ISSET(fd, &readyWrite); }
+  
+private:
+  fd_set watchedRead;
+  fd_set watchedWrite;
+  fd_set readyRead;
+  fd_set readyWrite;
+  int maxFd;
+};
+
+#endif // SOCKETUTIL_H
@@ -0,0 +1,31 @@
+/*
+ * Starting tasks pinned to a core
+ *
+ * On the ESP32 this is a FreeRTOS task. Built for a host (Linux/macOS) it
+ * is a plain pthread, priority and core are ignored there, so the proxy
+ * and web tasks can be run and tested without hardware. The same goes for
+ * the task watchdog, which only exists on the ESP32.
+ *
+ * Author: Johan Coppieters for Duotecno
+ * Date: November 2025
+ */
+
+#ifndef TASKUTIL_H
+#define TASKUTIL_H
+
+#include <Arduino.h>
+
+typedef void (*TaskMain)(void* arg);
+
+// Start a task that runs taskMain(arg), returns false if it could not be created
+bool startTask(TaskMain taskMain, const char* name, uint32_t stackSize, void* arg, int priority, int core);
+
+// Sleep the calling task (lets lower priority tasks on the same core run)
+void taskSleep(unsigned long ms);
+
+// Let the task watchdog restart the ESP32 when the calling task stops calling watchdogFeed()
+// for timeoutSeconds (a no-op on a host)
+void watchdogAdd(uint32_t timeoutSeconds);
+void watchdogFeed();
+
+#endif // TASKUTIL_H
@@ -0,0 +1,120 @@
+/*
+ * Hashed timer wheel: one deadline per connection slot
+ *
+ * Every connection has something to time out: its connect to the master, the
+ * heartbeats the cloud sends on free connections, the data of a client. The
+ * wheel keeps the next deadline of every slot in one of BUCKETS buckets, one
+ * per TIMER_WHEEL_TICK ms, so loop() neither asks every slot how long it may
+ * sleep nor visits a slot whose deadline is still far away:
+ *  - schedule() and cancel() move a slot between buckets (bit operations)
+ *  - expire() only looks at the buckets of the ticks that went by, and
+ *    returns the slots whose deadline passed
+ *  - msUntilNext() finds the next bucket with a deadline in it
+ *
+ * A deadline further away than a full turn of the wheel sits in the bucket
+ * it wraps around to and is passed over until its turn comes.
+ * Deadlines are millis() values, they expire at most one tick late.
+ *
+ * Author: Johan Coppieters for Duotecno
+ * Date: November 2025
+ */
+
+#ifndef TIMERWHEEL_H
+#define TIMERWHEEL_H
+
+#include <Arduino.h>
+#include "config.h"
+#include "SlotSet.h"
+
+// msUntilTimer() result when nothing is scheduled
+#define NO_TIMER ((unsigned long)-1)
+
+class TimerWheel {
+public:
+  static const int BUCKETS = 64;  // one bit per bucket in scheduled
+
+  TimerWheel() { clear(0); }
+
+  // Forget all deadlines, start ticking at now
+  void clear(unsigned long now) {
+    for (int b = 0; b < BUCKETS; b++) buckets[b].clear();
+    for (int s = 0; s < MAX_CONNECTIONS; s++) bucketOf[s] = -1;
+    scheduled = 0;
+    cursor = 0;
+    tickTime = now;
+  }
+
+  // (Re)arm the timer of slot, replaces its previous deadline
+  void schedule(int slot, unsigned long deadline) {
+    cancel(slot);
+    long delta = (long)(deadline - tickTime);
+    unsigned long ticks = (delta <= 0) ? 1 : (delta + TIMER_WHEEL_TICK - 1) / TIMER_WHEEL_TICK;
+    int b = (cursor + ticks) % BUCKETS;
+    buckets[b].add(slot);
+    bucketOf[slot] = b;
+    deadlines[slot] = deadline;
+    scheduled |= 1ULL << b;
+  }
+
+  void cancel(int slot) {
+    int b = bucketOf[slot];
+    if (b < 0) return;
+    buckets[b].remove(slot);
+    if (buckets[b].isEmpty()) scheduled &= ~(1ULL << b);
+    bucketOf[slot] = -1;
+  }
+
+  bool isScheduled(int slot) const { return bucketOf[slot] >= 0; }
+
+  // Advance to now: the slots whose deadline passed (their timers are cancelled)
+  SlotSet expire(unsigned long now) {
+    SlotSet expired;
+    int visited = 0;
+    while ((long)(now - tickTime) >= TIMER_WHEEL_TICK) {
+      tickTime += TIMER_WHEEL_TICK;
+      cursor = (cursor + 1) % BUCKETS;
+
+      SlotSet bucket = buckets[cursor];
+      for (int s = bucket.first(); s >= 0; s = bucket.next(s)) {
+        if ((long)(now - deadlines[s]) >= 0) {
+          expired.add(s);
+          cancel(s);
+        }
+      }
+
+      // Slept for more than a turn: every bucket was seen, skip the rest of the ticks
+      // (the cursor too, it has to stay on the bucket of the current tick)
+      if (++visited == BUCKETS) {
+        unsigned long skipped = (now - tickTime) / TIMER_WHEEL_TICK;
+        tickTime += skipped * TIMER_WHEEL_TICK;
+        cursor = (cursor + skipped) % BUCKETS;
+        break;
+      }
+    }
+    return expired;
+  }
+
+  // ms until the next bucket that holds a deadline is due, NO_TIMER if none
+  // (can be early: that bucket may only hold deadlines of a later turn)
+  unsigned long msUntilNext(unsigned long now) const {
+    if (scheduled == 0) return NO_TIMER;
+    uint64_t ahead = rotateRight(scheduled, (cursor + 1) % BUCKETS);
+    unsigned long due = tickTime + (unsigned long)(__builtin_ctzll(ahead) + 1) * TIMER_WHEEL_TICK;
+    long left = (long)(due - now);
+    return (left > 0) ? left : 0;
+  }
+
+private:
+  SlotSet buckets[BUCKETS];
+  int8_t bucketOf[MAX_CONNECTIONS];           // Bucket of every slot, -1 if it has no timer
+  unsigned long deadlines[MAX_CONNECTIONS];
+  uint64_t scheduled;                         // Buckets that are not empty
+  int cursor;                                 // Bucket of the current tick
+  unsigned long tickTime;                     // millis() at which the current tick started
+
+  static uint64_t rotateRight(uint64_t bits, int n) {
+    return n ? (bits >> n) | (bits << (64 - n)) : bits;
+  }
+};
+
+#endif // TIMERWHEEL_H
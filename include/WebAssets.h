@@ -0,0 +1,648 @@
+/*
+ * Web interface pages, gzipped - GENERATED by tools/embed_web.py from web/
+ * Do not edit, change the page in web/ and rebuild.
+ */
+
+#ifndef WEBASSETS_H
+#define WEBASSETS_H
+
+#include <Arduino.h>
+
+// web/index.html: 32550 bytes, 8843 gzipped
+#define INDEX_HTML_ETAG "\"50ed9fb88539c213\""
+static const size_t INDEX_HTML_GZ_LEN = 8843;
+static const uint8_t INDEX_HTML_GZ[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xd5, 0x7d, 0xdb, 0x8e, 0xdc, 0x48,
+  0x7a, 0xe6, 0xbd, 0x9e, 0x22, 0x3a, 0x7b, 0xdb, 0x99, 0x65, 0x55, 0xb2, 0x78, 0x3e, 0xd4, 0xa9,
+  0x21, 0xa5, 0x5a, 0x96, 0xd0, 0x52, 0xb7, 0xd0, 0xa5, 0x6e, 0x63, 0xa6, 0xad, 0x35, 0x58, 0x99,
+  0xcc, 0x4a, 0x5a, 0xcc, 0x64, 0x0e, 0xc9, 0x54, 0xa9, 0x46, 0x23, 0x60, 0x17, 0x58, 0xcc, 0x95,
+  0x17, 0x5e, 0xdb, 0x03, 0xac, 0x6d, 0x18, 0x18, 0xdf, 0xee, 0x03, 0x2c, 0xb0, 0x57, 0x7b, 0xe1,
+  0x47, 0xe9, 0x17, 0xd8, 0x79, 0x84, 0xfd, 0xfe, 0x88, 0x20, 0x19, 0x64, 0x32, 0xab, 0x58, 0xaa,
+  0xea, 0xc6, 0xee, 0x34, 0x46, 0x55, 0x71, 0xfa, 0xe3, 0x3f, 0xff, 0x7f, 0x9c, 0x58, 0xc7, 0x9f,
+  0x3d, 0xf9, 0x76, 0xf2, 0xfa, 0x57, 0xaf, 0xbe, 0x62, 0x8b, 0x62, 0x99, 0x9c, 0x3e, 0x38, 0x2e,
+  0x7f, 0x44, 0xe1, 0xec, 0xf4, 0x01, 0x63, 0xc7, 0xcb, 0xa8, 0x08, 0xd9, 0x74, 0x11, 0x66, 0x79,
+  0x54, 0x9c, 0x0c, 0xbe, 0x7f, 0xfd, 0x74, 0xec, 0x0f, 0xea, 0x86, 0x55, 0xb8, 0x8c, 0x4e, 0x06,
+  0xef, 0xe2, 0xe8, 0x72, 0x9d, 0x66, 0xc5, 0x80, 0x4d, 0xd3, 0x55, 0x11, 0xad, 0xd0, 0xf1, 0x32,
+  0x9e, 0x15, 0x8b, 0x93, 0x59, 0xf4, 0x2e, 0x9e, 0x46, 0x63, 0x5e, 0xd8, 0x67, 0xf1, 0x2a, 0x2e,
+  0xe2, 0x30, 0x19, 0xe7, 0xd3, 0x30, 0x89, 0x4e, 0x0c, 0x4d, 0x17, 0x80, 0x8a, 0xb8, 0x48, 0xa2,
+  0xd3, 0x27, 0x9b, 0xb4, 0x88, 0xa6, 0xab, 0x94, 0x4d, 0x92, 0x74, 0x33, 0x63, 0xaf, 0xb2, 0xf4,
+  0xfd, 0x15, 0x9b, 0xa4, 0xab, 0x79, 0x7c, 0xb1, 0xc9, 0xc2, 0x22, 0x4e, 0x57, 0xc7, 0x07, 0xa2,
+  0x27, 0x8d, 0xf9, 0x6c, 0x3c, 0xc6, 0x0f, 0xc6, 0xce, 0xa2, 0xec, 0x5d, 0x34, 0x63, 0x17, 0xbf,
+  0x8d, 0xd7, 0x6b, 0xfc, 0x9c, 0x67, 0xe9, 0x92, 0xcd, 0x93, 0x30, 0x5f, 0xb0, 0x51, 0xbc, 0x9a,
+  0x26, 0x9b, 0x59, 0x74, 0xf0, 0x97, 0xd1, 0xf9, 0xa3, 0x1c, 0xc8, 0xe7, 0x1a, 0x50, 0x58, 0x86,
+  0xb3, 0x88, 0x9d, 0x5f, 0xb1, 0x22, 0x4d, 0x93, 0xfc, 0x20, 0x5a, 0x9e, 0x47, 0xb3, 0xbf, 0xbe,
+  0x8c, 0xce, 0xb5, 0xf5, 0xd5, 0x9e, 0xc6, 0x01, 0xbe, 0x5e, 0x44, 0x6c, 0x1d, 0x5e, 0x44, 0x2c,
+  0x2e, 0xf2, 0x28, 0x99, 0xb3, 0x55, 0xf4, 0x2e, 0xca, 0x88, 0xfe, 0xd5, 0x45, 0x94, 0x1f, 0xb2,
+  0x02, 0xcd, 0x80, 0x55, 0xc4, 0xab, 0x8b, 0x1c, 0xc4, 0x2e, 0x23, 0x31, 0xe5, 0xc1, 0x94, 0x23,
+  0xba, 0xcf, 0xdb, 0xa7, 0xe9, 0x06, 0x4c, 0xc8, 0x72, 0xd9, 0x94, 0x17, 0x61, 0xb1, 0xc9, 0x09,
+  0xfa, 0x78, 0xcc, 0x71, 0xcf, 0x8b, 0x2b, 0x41, 0x05, 0x63, 0x7f, 0xce, 0x3e, 0x00, 0xa5, 0xec,
+  0x22, 0x5e, 0x1d, 0x32, 0xfd, 0x08, 0x13, 0xcf, 0x66, 0x80, 0xcc, 0x7f, 0x3f, 0x4f, 0xdf, 0x8f,
+  0xf3, 0xf8, 0xb7, 0xbc, 0x78, 0x9e, 0x66, 0xb3, 0x28, 0x1b, 0xa3, 0xea, 0x88, 0x7d, 0xe4, 0x03,
+  0xcf, 0xd3, 0xd9, 0x15, 0xc6, 0xce, 0xc1, 0xee, 0xf1, 0x3c, 0x5c, 0xc6, 0xc9, 0xd5, 0x21, 0x1b,
+  0x87, 0xeb, 0x75, 0x12, 0x8d, 0xf3, 0xab, 0xbc, 0x88, 0x96, 0xfb, 0xec, 0x71, 0x12, 0xaf, 0xde,
+  0xbe, 0x0c, 0xa7, 0x67, 0xbc, 0xfc, 0x14, 0x3d, 0xf7, 0xd9, 0xf0, 0x2c, 0xba, 0x48, 0x23, 0xf6,
+  0xfd, 0xf3, 0xe1, 0x3e, 0xfb, 0x2e, 0x3d, 0x4f, 0x8b, 0x74, 0x9f, 0x3d, 0xca, 0x20, 0x93, 0x7d,
+  0x96, 0x87, 0xab, 0x7c, 0x9c, 0x47, 0x59, 0x3c, 0xc7, 0xdc, 0xe1, 0xf4, 0xed, 0x45, 0x06, 0x32,
+  0x66, 0x87, 0x0c, 0x50, 0xa2, 0x30, 0x1b, 0x5f, 0x64, 0xe1, 0x2c, 0x86, 0x64, 0x47, 0x86, 0xe5,
+  0xcc, 0x22, 0x50, 0xfa, 0xb9, 0xeb, 0x7a, 0x51, 0x14, 0x32, 0xfd, 0x0b, 0xfc, 0xee, 0xb9, 0xf6,
+  0x79, 0x68, 0x32, 0x43, 0xd7, 0xbf, 0xd8, 0x3b, 0x62, 0xcb, 0x78, 0x35, 0x5e, 0x44, 0xf1, 0xc5,
+  0xa2, 0x38, 0xa4, 0xaa, 0x77, 0x0b, 0x85, 0x32, 0x53, 0x5f, 0x83, 0x88, 0x59, 0x9c, 0xaf, 0x93,
+  0x10, 0x38, 0xcf, 0x93, 0x08, 0xc5, 0x30, 0x89, 0x2f, 0x56, 0xe3, 0x18, 0x68, 0xe6, 0xa2, 0x6a,
+  0x0c, 0xa6, 0x65, 0xc5, 0x11, 0xfb, 0x9b, 0x4d, 0x5e, 0xc4, 0xf3, 0xab, 0xb1, 0x54, 0xab, 0x43,
+  0x36, 0x8d, 0x88, 0xb5, 0x47, 0x9c, 0x07, 0x82, 0x13, 0x1a, 0xb5, 0x85, 0x40, 0x32, 0x03, 0x3f,
+  0x54, 0xc4, 0x2f, 0x17, 0x00, 0x78, 0x54, 0xf2, 0x8e, 0xd0, 0xdf, 0x00, 0xba, 0x61, 0xd2, 0xfc,
+  0x9c, 0xb9, 0x8b, 0x70, 0x96, 0x5e, 0x82, 0xd7, 0x1c, 0x27, 0xe6, 0xd2, 0x3f, 0xd9, 0xc5, 0x79,
+  0x38, 0xd2, 0xf7, 0xf9, 0x7f, 0x9a, 0x45, 0xa4, 0x84, 0xef, 0x85, 0xf6, 0x72, 0x4a, 0x38, 0xee,
+  0x75, 0xf1, 0x8b, 0xa3, 0x5a, 0x78, 0x2c, 0xdc, 0x14, 0xe9, 0x11, 0x4b, 0xa1, 0x2d, 0xf3, 0x84,
+  0xc0, 0x2e, 0xe2, 0xd9, 0x2c, 0x5a, 0xa9, 0x88, 0x9e, 0x17, 0x2b, 0xa0, 0x58, 0x71, 0xc2, 0x70,
+  0x30, 0xa1, 0xad, 0x0b, 0x74, 0x08, 0xc7, 0x43, 0xb6, 0x4a, 0x57, 0xdb, 0x18, 0xbb, 0xd4, 0x83,
+  0x0b, 0x1a, 0xea, 0x10, 0x61, 0x5c, 0x5d, 0x71, 0x29, 0x99, 0xec, 0xe8, 0x50, 0x98, 0xe9, 0x26,
+  0xcb, 0x53, 0x00, 0x59, 0xa7, 0x31, 0xe7, 0x11, 0x2b, 0x32, 0x88, 0x34, 0x26, 0xcb, 0x39, 0x04,
+  0x87, 0x13, 0xa6, 0x6b, 0x66, 0x5e, 0x63, 0x6c, 0xf0, 0x99, 0x8b, 0xe8, 0x7d, 0x31, 0x9e, 0x45,
+  0xd3, 0x54, 0x98, 0x58, 0x89, 0x42, 0x25, 0x9f, 0x78, 0x45, 0xf2, 0x1f, 0x9f, 0x27, 0xe9, 0xf4,
+  0xed, 0x51, 0x8b, 0x98, 0xf1, 0x3a, 0x8b, 0x01, 0xed, 0xaa, 0xc5, 0xf7, 0x4f, 0x50, 0x98, 0x69,
+  0x9a, 0x10, 0xe6, 0x52, 0x62, 0xa4, 0x00, 0xc0, 0x6f, 0xc7, 0x6c, 0x87, 0x0b, 0xe2, 0x31, 0xe6,
+  0xe4, 0xe4, 0xcd, 0xd3, 0x6c, 0x79, 0x28, 0x7e, 0x4d, 0xc2, 0x22, 0xfa, 0xd5, 0x68, 0x0c, 0xf9,
+  0xee, 0xb5, 0x05, 0x4c, 0x9c, 0xe6, 0xec, 0xe6, 0xf2, 0x35, 0x74, 0x73, 0x1f, 0x7a, 0xe0, 0xee,
+  0x33, 0xd3, 0xb2, 0xf7, 0xc1, 0x16, 0x7b, 0x6f, 0x8b, 0xb4, 0x1c, 0x2c, 0x59, 0xcd, 0xb6, 0x89,
+  0xfb, 0xdc, 0x9d, 0x7a, 0x8e, 0x37, 0x6b, 0xa1, 0xbc, 0x73, 0x74, 0x85, 0x6c, 0x03, 0x86, 0x13,
+  0xba, 0xa6, 0xeb, 0x1f, 0x5d, 0x47, 0x81, 0x0a, 0x91, 0x5c, 0xf1, 0x16, 0x90, 0x3b, 0x73, 0xb9,
+  0xd2, 0x43, 0xab, 0x56, 0x04, 0x6e, 0x87, 0xa5, 0x91, 0xb5, 0xa6, 0x5f, 0x18, 0xa5, 0xbf, 0x11,
+  0x6a, 0x68, 0xfa, 0x34, 0x4c, 0x68, 0x13, 0x3c, 0x53, 0x51, 0xa4, 0xcb, 0x52, 0xa9, 0x9a, 0x03,
+  0xd7, 0x18, 0x97, 0xae, 0xc3, 0x69, 0x5c, 0x40, 0x9f, 0x74, 0x2d, 0x68, 0x2a, 0xb3, 0xad, 0x0c,
+  0x10, 0x9e, 0x52, 0xb5, 0x11, 0x6e, 0x99, 0x02, 0xc1, 0x06, 0x07, 0xe7, 0xfe, 0x3c, 0x98, 0x87,
+  0x47, 0xb5, 0x63, 0x94, 0xd3, 0xa3, 0x77, 0x9e, 0x26, 0xf1, 0x8c, 0x7d, 0x1e, 0x05, 0xd1, 0x34,
+  0x9a, 0x37, 0x21, 0x83, 0x5b, 0x68, 0xfa, 0x50, 0x6b, 0x37, 0x95, 0x8f, 0xf8, 0xbf, 0x63, 0xf8,
+  0x9e, 0x35, 0xf1, 0x1f, 0xae, 0x26, 0xd9, 0x2c, 0x57, 0xb0, 0xbb, 0x2c, 0x5a, 0x47, 0x61, 0x31,
+  0x22, 0xbb, 0x1e, 0xcf, 0x63, 0x38, 0x4f, 0xb8, 0x35, 0xb8, 0x83, 0x91, 0xe1, 0x00, 0x1f, 0x28,
+  0xd0, 0x3c, 0xdb, 0x03, 0x53, 0x2f, 0xc2, 0xb5, 0x34, 0xe5, 0xe6, 0x54, 0xe4, 0xcc, 0xba, 0x1d,
+  0x52, 0xc3, 0x01, 0x6c, 0x59, 0xbb, 0xaf, 0xd4, 0x25, 0xd1, 0x1c, 0xc6, 0x6d, 0xd7, 0x44, 0x49,
+  0xd9, 0x76, 0xcc, 0x94, 0x84, 0xe7, 0x51, 0xa2, 0x92, 0x26, 0x2c, 0xb6, 0xc1, 0x6a, 0xee, 0xf9,
+  0xa4, 0x12, 0x54, 0x7a, 0xdc, 0x12, 0x20, 0xa1, 0xc4, 0xa1, 0x77, 0xfe, 0x8f, 0x2b, 0x89, 0xa2,
+  0xb5, 0x1b, 0x04, 0xdd, 0x6c, 0x1a, 0xe6, 0xa0, 0x2a, 0x41, 0x50, 0x04, 0xca, 0x39, 0x09, 0x9a,
+  0x47, 0x30, 0x6d, 0x07, 0x4f, 0xb4, 0x77, 0x61, 0xb2, 0x89, 0x9a, 0xba, 0xd4, 0xe1, 0xd2, 0xce,
+  0xd3, 0xa4, 0xb6, 0xb2, 0xcf, 0x2d, 0xcb, 0xda, 0x0d, 0x4b, 0xbb, 0x48, 0x53, 0x12, 0x6b, 0xd9,
+  0xd9, 0xf4, 0x43, 0xcf, 0x76, 0xae, 0xe9, 0x7f, 0x19, 0x66, 0x2b, 0x20, 0xa9, 0x0c, 0x99, 0xcf,
+  0xa7, 0x86, 0xee, 0xa9, 0x11, 0x05, 0x26, 0xa0, 0x2a, 0x22, 0xe9, 0x60, 0x05, 0x31, 0x9a, 0x92,
+  0xaf, 0xac, 0x42, 0x77, 0xc5, 0xbc, 0xae, 0x4e, 0x0b, 0xb3, 0x65, 0x36, 0x7a, 0x97, 0xd9, 0x38,
+  0xaa, 0x68, 0x40, 0xec, 0x96, 0x66, 0x9b, 0x6d, 0x25, 0xa8, 0xf4, 0xa8, 0x61, 0x7b, 0xe5, 0xec,
+  0x24, 0x9e, 0x31, 0xe9, 0xdd, 0x7a, 0x1b, 0x4b, 0xb3, 0xbb, 0xdf, 0x2e, 0x0d, 0x6a, 0x8d, 0xf6,
+  0x55, 0x4c, 0xed, 0xc0, 0xd1, 0x1d, 0xaf, 0x2b, 0x18, 0xb5, 0x4c, 0xbc, 0x63, 0xbe, 0x78, 0xb5,
+  0xde, 0x14, 0x3f, 0x16, 0x57, 0x6b, 0xe4, 0x8f, 0xa4, 0x57, 0x83, 0x37, 0xfb, 0xd7, 0xf6, 0x59,
+  0x6d, 0x90, 0xac, 0x65, 0x83, 0x37, 0x40, 0xb1, 0x11, 0x81, 0x6b, 0x73, 0x32, 0xd5, 0x50, 0x6a,
+  0xb6, 0x5d, 0xc1, 0x35, 0x6a, 0xdd, 0xfc, 0xdf, 0x4d, 0xe1, 0x97, 0x7b, 0x2c, 0x35, 0xb6, 0xca,
+  0x01, 0x9c, 0x29, 0x3c, 0xc8, 0xee, 0xa2, 0xf6, 0x70, 0x9e, 0x4e, 0xb9, 0x7f, 0x4b, 0x37, 0x05,
+  0xf9, 0xef, 0x56, 0xc0, 0xaf, 0x4c, 0xb3, 0x61, 0xe5, 0xd3, 0x45, 0x34, 0x7d, 0x4b, 0xe1, 0xac,
+  0x14, 0xe7, 0x75, 0xb9, 0x93, 0x4c, 0x8f, 0xa4, 0x57, 0x52, 0x04, 0xdd, 0x82, 0xa2, 0x32, 0xb6,
+  0x6c, 0x52, 0x59, 0x2b, 0xb4, 0xb4, 0xcc, 0xe1, 0x44, 0x69, 0x2b, 0xbf, 0x50, 0x12, 0x57, 0x91,
+  0xb3, 0x2d, 0x32, 0x64, 0x9c, 0x14, 0x6f, 0xbb, 0x27, 0x2d, 0x35, 0xac, 0xa5, 0x51, 0xfa, 0x56,
+  0xba, 0xb1, 0x35, 0x57, 0x09, 0x50, 0x1a, 0x2e, 0x25, 0xc2, 0xed, 0x98, 0x3a, 0x9f, 0xcf, 0xad,
+  0xe9, 0x6c, 0xb7, 0xeb, 0x14, 0x16, 0xde, 0xf6, 0xbe, 0x0f, 0x7a, 0xca, 0xbf, 0x24, 0x95, 0xdb,
+  0x8e, 0x5e, 0x1b, 0x80, 0xef, 0xb8, 0xb6, 0x6e, 0x77, 0xa1, 0x97, 0x17, 0x59, 0xca, 0x5d, 0xcc,
+  0x0d, 0xf6, 0xa4, 0x78, 0x49, 0x90, 0x82, 0xf8, 0x93, 0xa5, 0x97, 0xbd, 0x43, 0x94, 0x35, 0xcf,
+  0x98, 0x89, 0xff, 0x23, 0x16, 0x75, 0xc8, 0x3c, 0xc7, 0x7c, 0x51, 0x71, 0x2b, 0x80, 0x32, 0xe6,
+  0xd9, 0x22, 0xbc, 0x75, 0xc0, 0x3c, 0xdf, 0x00, 0xed, 0xd5, 0x2e, 0x5d, 0xac, 0xba, 0x57, 0x64,
+  0x16, 0xe9, 0xba, 0xe9, 0x17, 0xe7, 0x69, 0x5a, 0x88, 0xf4, 0x6d, 0x2b, 0xe1, 0xd8, 0x5a, 0x25,
+  0x74, 0x86, 0xfc, 0x76, 0x00, 0x6b, 0x45, 0xb8, 0x66, 0xf2, 0x31, 0xae, 0x5d, 0x79, 0x6f, 0xb3,
+  0x51, 0xfd, 0xa3, 0x84, 0x42, 0xb8, 0x92, 0x1b, 0x17, 0x89, 0x69, 0x57, 0xe3, 0x2d, 0xb2, 0x23,
+  0x95, 0x70, 0x52, 0xd3, 0x2e, 0x70, 0x3d, 0x72, 0xa6, 0x4e, 0x30, 0xc7, 0x07, 0x72, 0x71, 0x79,
+  0x7c, 0x20, 0x16, 0xf0, 0xc7, 0xb4, 0x50, 0xe4, 0xab, 0xce, 0x59, 0xfc, 0x8e, 0x4d, 0xb1, 0x32,
+  0xce, 0x61, 0xf1, 0xe5, 0x8a, 0x69, 0x20, 0x56, 0xa1, 0x6a, 0x9b, 0xc0, 0x42, 0x36, 0x74, 0x35,
+  0x95, 0x2c, 0x45, 0x97, 0xe3, 0xfc, 0xdd, 0x85, 0xf0, 0x18, 0x27, 0x03, 0x57, 0x1f, 0x48, 0x7f,
+  0x81, 0xdf, 0xcd, 0x01, 0xa3, 0x2d, 0x81, 0xc7, 0xe9, 0xfb, 0x93, 0x81, 0x0e, 0x7f, 0x60, 0x38,
+  0x0e, 0xfd, 0x13, 0x04, 0x03, 0x36, 0x8f, 0x93, 0x04, 0xce, 0x1c, 0x7e, 0x6f, 0xc0, 0xde, 0x2f,
+  0x93, 0x15, 0xc1, 0x2d, 0x8a, 0xf5, 0xe1, 0xc1, 0xc1, 0xe5, 0xe5, 0xa5, 0x76, 0x69, 0x69, 0x69,
+  0x76, 0x71, 0x60, 0x62, 0xa9, 0x75, 0x00, 0xe0, 0x03, 0xc6, 0xc9, 0x39, 0x19, 0x34, 0xfd, 0xcb,
+  0x11, 0xcd, 0xbd, 0x0e, 0x8b, 0x05, 0x9b, 0x9d, 0x0c, 0x5e, 0x3a, 0xb6, 0xe6, 0xea, 0xba, 0xc5,
+  0x1c, 0x4d, 0x77, 0x1d, 0xc3, 0x99, 0xd8, 0x81, 0x16, 0x38, 0xb6, 0xc9, 0x02, 0xcd, 0x33, 0x0c,
+  0xd3, 0x63, 0xb6, 0xab, 0xd9, 0x6e, 0xe0, 0x32, 0xd3, 0xb6, 0x34, 0xc3, 0x0b, 0xaa, 0xb2, 0x63,
+  0xa2, 0xac, 0x7b, 0x93, 0xb2, 0x8c, 0x65, 0x81, 0xa5, 0x79, 0x16, 0xab, 0xcb, 0x96, 0xa1, 0xf9,
+  0x18, 0x67, 0x69, 0xa6, 0x15, 0x94, 0xc5, 0xc9, 0xd8, 0xd5, 0x02, 0x57, 0xf7, 0x8d, 0xaa, 0x7d,
+  0xec, 0x6b, 0x86, 0x69, 0x22, 0x41, 0x01, 0x30, 0x5f, 0xb3, 0x4c, 0x66, 0x9a, 0x9a, 0xee, 0x79,
+  0x36, 0xca, 0x3e, 0x40, 0x01, 0x21, 0x74, 0x33, 0x2d, 0x07, 0xe5, 0xc0, 0xd0, 0x0c, 0x66, 0xdb,
+  0x9a, 0x61, 0xbb, 0x28, 0xa2, 0xbf, 0x66, 0xb9, 0xcc, 0xf6, 0x35, 0x2f, 0x30, 0x31, 0x9f, 0xe9,
+  0x05, 0x9a, 0xe9, 0x4e, 0x4a, 0x7a, 0x0c, 0x10, 0xa3, 0xe9, 0x0e, 0xf3, 0x80, 0xa6, 0x6f, 0x7b,
+  0xc4, 0x44, 0x5f, 0xa3, 0x7a, 0xcf, 0xd3, 0x3c, 0x13, 0x59, 0xbd, 0xe3, 0x9b, 0x9a, 0x6d, 0x4e,
+  0x4c, 0xdd, 0xd5, 0x3c, 0xd7, 0xa0, 0x72, 0xa0, 0x01, 0x51, 0x53, 0x0f, 0x34, 0xdd, 0xb7, 0xa9,
+  0xec, 0x01, 0x11, 0xa5, 0x4c, 0x33, 0xd9, 0x93, 0xba, 0x6c, 0x58, 0x9a, 0x4f, 0xfd, 0x1d, 0x0d,
+  0xa2, 0x41, 0x59, 0x07, 0x7c, 0x9f, 0x19, 0xbe, 0xa1, 0x99, 0xba, 0x57, 0x96, 0x27, 0x86, 0x0b,
+  0xb6, 0xf0, 0xfe, 0xb2, 0xdd, 0x36, 0x35, 0xdf, 0x43, 0x3b, 0xa2, 0xbf, 0x66, 0x61, 0x5e, 0xd3,
+  0xd7, 0x02, 0x8b, 0xea, 0x81, 0x98, 0x1f, 0x4c, 0x0c, 0xe0, 0xe3, 0xbb, 0x80, 0x67, 0x3b, 0xba,
+  0xa6, 0x13, 0x9f, 0x6c, 0xcd, 0xb1, 0x41, 0x9f, 0x0d, 0x7e, 0xd9, 0x66, 0x5d, 0xc6, 0x1a, 0x48,
+  0xf3, 0x8d, 0x1f, 0xc0, 0x26, 0x48, 0xcc, 0x7a, 0x66, 0x38, 0x18, 0x07, 0xf9, 0x99, 0x68, 0xb7,
+  0x09, 0x9e, 0xa8, 0xaf, 0xf1, 0xd7, 0x41, 0x0f, 0xe8, 0xac, 0xcb, 0x2e, 0x2c, 0xa3, 0x26, 0x47,
+  0xb7, 0xc0, 0x58, 0x9f, 0xd5, 0xc3, 0x85, 0x78, 0x24, 0xd8, 0xb2, 0xfc, 0x4c, 0x4e, 0xff, 0x02,
+  0xe2, 0xd6, 0x20, 0x36, 0xe6, 0x18, 0x3e, 0xe4, 0x6d, 0x4c, 0x02, 0x30, 0xc7, 0x02, 0x1c, 0xd7,
+  0x41, 0x11, 0xec, 0x0e, 0x20, 0x3b, 0xb0, 0x8c, 0x59, 0x5a, 0xa0, 0x5b, 0xae, 0xc9, 0xc0, 0x15,
+  0x0b, 0x22, 0xa0, 0xe5, 0xa2, 0x11, 0xe8, 0xa6, 0x3f, 0xf1, 0x74, 0x80, 0x33, 0x3c, 0x36, 0xd6,
+  0xc1, 0x55, 0xd3, 0x01, 0xa5, 0x0e, 0xe4, 0x87, 0xb1, 0x55, 0x17, 0xd6, 0x52, 0xcd, 0x5f, 0x97,
+  0xea, 0x8f, 0xf0, 0x96, 0xc1, 0x84, 0x26, 0xe4, 0xca, 0x06, 0x07, 0xaa, 0x32, 0x7b, 0x50, 0x21,
+  0xd2, 0x25, 0xd3, 0x20, 0x2d, 0xb4, 0x7e, 0xb0, 0x6c, 0x82, 0xee, 0xbd, 0xf0, 0x4c, 0x9a, 0xde,
+  0x67, 0x96, 0x6b, 0x68, 0xae, 0xe3, 0x4c, 0x5c, 0x68, 0xb9, 0x05, 0xc8, 0x16, 0x78, 0x62, 0x42,
+  0x28, 0x0e, 0x54, 0xcd, 0x81, 0x52, 0xda, 0xa0, 0x36, 0x60, 0x0e, 0x44, 0x06, 0x85, 0x73, 0x2c,
+  0x28, 0x80, 0x4d, 0x1a, 0x05, 0x89, 0xa2, 0xd1, 0x25, 0x56, 0x81, 0x83, 0x55, 0x19, 0x3f, 0x1d,
+  0x1f, 0xe8, 0xb9, 0x26, 0x38, 0x17, 0x30, 0xd8, 0x8b, 0x66, 0x7a, 0xce, 0xc4, 0x09, 0x2c, 0x0d,
+  0x94, 0xfa, 0xc0, 0x21, 0x80, 0x1e, 0xbb, 0xd0, 0x4b, 0x07, 0x73, 0xf9, 0x81, 0xae, 0x41, 0x69,
+  0x98, 0xe7, 0x39, 0x5a, 0x60, 0xa0, 0x88, 0x1f, 0x8e, 0xff, 0xc2, 0x07, 0x03, 0x7d, 0xdf, 0x43,
+  0xd9, 0x27, 0xa8, 0x2f, 0x7c, 0xe8, 0xbf, 0xe5, 0x01, 0x95, 0xc0, 0xc6, 0x6c, 0xc1, 0xc4, 0x37,
+  0xc1, 0x85, 0xc0, 0x26, 0x86, 0xfa, 0xa6, 0x13, 0xb0, 0xaa, 0x6c, 0x40, 0x3b, 0x7c, 0x30, 0x56,
+  0x37, 0x88, 0xe3, 0x65, 0x79, 0xe2, 0x79, 0xa4, 0xc6, 0x4e, 0xd5, 0x5e, 0xb2, 0x24, 0xf0, 0xb4,
+  0xc0, 0x07, 0x3a, 0x2d, 0x16, 0xfd, 0xba, 0xe2, 0x19, 0x16, 0xd5, 0x9a, 0xed, 0x5b, 0x3f, 0xf8,
+  0x16, 0x14, 0xda, 0x09, 0x5e, 0x78, 0x8e, 0xa9, 0xb9, 0x3e, 0xe6, 0xf3, 0xa0, 0x76, 0xfe, 0xc4,
+  0x85, 0xc0, 0x4c, 0x03, 0x78, 0xeb, 0x16, 0xcc, 0xc8, 0x45, 0x77, 0xb0, 0xce, 0x02, 0x3c, 0xb0,
+  0xcc, 0xf1, 0x1c, 0x70, 0x07, 0xf8, 0x22, 0x98, 0xbb, 0x6e, 0xa0, 0x11, 0xd3, 0x40, 0x2d, 0xa4,
+  0xc6, 0x5c, 0x90, 0x67, 0x39, 0x56, 0xd5, 0x4c, 0xcc, 0x73, 0x03, 0x93, 0xb9, 0x16, 0x86, 0x91,
+  0x7b, 0x21, 0xc5, 0x81, 0xda, 0xba, 0x2e, 0xf4, 0x4e, 0x27, 0xf7, 0xa1, 0x6b, 0x96, 0x0f, 0xb3,
+  0x35, 0x01, 0xc6, 0x86, 0xbb, 0x01, 0x9a, 0x26, 0xf4, 0x89, 0xa6, 0x31, 0x40, 0xa6, 0x2c, 0x83,
+  0x4c, 0xb2, 0x4e, 0xb3, 0x6e, 0x97, 0x54, 0xd8, 0x18, 0x07, 0x4f, 0xc4, 0x5a, 0x54, 0xf5, 0xd0,
+  0x1d, 0xc3, 0x02, 0x67, 0xa1, 0xe9, 0x16, 0xfc, 0x84, 0xe1, 0x19, 0x13, 0x03, 0xca, 0xa8, 0x11,
+  0x44, 0x72, 0x40, 0x64, 0x88, 0x26, 0x94, 0x28, 0x20, 0x0d, 0xc7, 0x0c, 0x64, 0xe0, 0x26, 0x50,
+  0x80, 0xa1, 0x7a, 0xbe, 0x03, 0xbb, 0xb2, 0x27, 0x86, 0x85, 0xfe, 0x70, 0x2c, 0x81, 0x4d, 0x7e,
+  0x05, 0xfd, 0x61, 0x16, 0xe0, 0x18, 0x83, 0x71, 0xc3, 0x0e, 0xc9, 0x92, 0x20, 0x59, 0x8f, 0x30,
+  0xf5, 0x08, 0xa3, 0x09, 0xac, 0x81, 0x5c, 0x19, 0x73, 0xa1, 0x08, 0x3a, 0x59, 0x98, 0xe3, 0x00,
+  0x9e, 0xc9, 0x1c, 0x07, 0xda, 0x47, 0x8e, 0xc2, 0x01, 0x29, 0x10, 0x98, 0x0d, 0xf5, 0xf2, 0x74,
+  0x38, 0x06, 0x1b, 0x22, 0xb5, 0x0d, 0x66, 0x59, 0x90, 0x0b, 0x0c, 0xc7, 0xb0, 0xa0, 0x67, 0xb0,
+  0x38, 0xd3, 0xc7, 0x0f, 0xf2, 0x9f, 0x4d, 0xfc, 0x7f, 0xfd, 0x92, 0x7b, 0x10, 0x0f, 0x1e, 0x92,
+  0x5c, 0xb0, 0xe1, 0x01, 0x00, 0xb4, 0x1d, 0x1e, 0xc1, 0x26, 0xd3, 0xe3, 0x0e, 0x09, 0x84, 0x79,
+  0x50, 0x73, 0xe0, 0x4b, 0xf4, 0xd9, 0x50, 0x31, 0x1d, 0x82, 0x45, 0xd9, 0x0c, 0x4c, 0xea, 0x0e,
+  0x42, 0x41, 0x9f, 0x07, 0x36, 0x90, 0xc3, 0xb4, 0xad, 0x80, 0xf0, 0xf5, 0x39, 0xda, 0x18, 0x6f,
+  0x79, 0xf8, 0x05, 0xfa, 0x01, 0x13, 0x87, 0x9b, 0x86, 0x1f, 0x83, 0x62, 0xba, 0x60, 0x07, 0x66,
+  0x0b, 0x88, 0x5d, 0x50, 0x04, 0x07, 0x71, 0x02, 0x56, 0xc3, 0xb1, 0x05, 0x32, 0x98, 0xcd, 0x86,
+  0x3e, 0x38, 0xc4, 0x5d, 0x0b, 0xee, 0xd7, 0x24, 0x0b, 0xb4, 0xa1, 0xfe, 0xe4, 0xde, 0xc0, 0x5d,
+  0xc8, 0xd3, 0x82, 0x25, 0xea, 0xb6, 0xcf, 0x5a, 0xc8, 0xf7, 0x90, 0x5f, 0x60, 0x78, 0x9c, 0x2f,
+  0xae, 0x81, 0x79, 0x0d, 0x77, 0x52, 0x96, 0x7d, 0xcc, 0x60, 0xd9, 0x64, 0x20, 0xd0, 0x34, 0x0f,
+  0x0a, 0x1d, 0x80, 0x5e, 0x28, 0x6c, 0x60, 0x13, 0x1b, 0xaa, 0xf2, 0x04, 0xc6, 0x08, 0xf3, 0xad,
+  0x9b, 0xa1, 0x90, 0x3a, 0x75, 0x2f, 0x87, 0x97, 0x65, 0x48, 0xd5, 0x30, 0xec, 0x1f, 0x7c, 0x92,
+  0x8e, 0x63, 0xbd, 0x08, 0xc0, 0x35, 0x17, 0xec, 0xf3, 0x1d, 0x0a, 0x9c, 0x26, 0xf9, 0x6f, 0x30,
+  0x04, 0x0e, 0x10, 0xd2, 0x08, 0x02, 0x10, 0x02, 0x4a, 0xc9, 0xcf, 0x07, 0x3a, 0x79, 0x48, 0x30,
+  0xc2, 0xe0, 0x1a, 0x0e, 0xbe, 0x41, 0x5b, 0x5c, 0xc4, 0x07, 0xc3, 0xf5, 0xc8, 0xdb, 0xf8, 0x5c,
+  0x1a, 0x60, 0x84, 0x41, 0x11, 0x0b, 0x86, 0x83, 0x79, 0x1d, 0x8a, 0x4b, 0xb2, 0x4c, 0x4e, 0xc9,
+  0x73, 0x01, 0x5f, 0x96, 0x2d, 0xf2, 0x8e, 0x3e, 0xc1, 0xf3, 0xa0, 0x96, 0x01, 0x23, 0xed, 0x73,
+  0x1c, 0x1a, 0x4f, 0x11, 0xdc, 0x2c, 0xcb, 0x13, 0x0a, 0xe2, 0x1a, 0x0c, 0xaa, 0x6e, 0xc7, 0xc4,
+  0x50, 0xdb, 0x7a, 0xbc, 0x28, 0x3b, 0x40, 0xcb, 0xf4, 0x08, 0x1f, 0x51, 0x76, 0x61, 0x40, 0x1e,
+  0x1c, 0x38, 0xca, 0x26, 0x8f, 0xa3, 0x5c, 0x79, 0x88, 0x1e, 0x8a, 0xab, 0xc0, 0x1f, 0x06, 0x6d,
+  0x04, 0x50, 0x4b, 0x03, 0x88, 0x93, 0x5a, 0x40, 0xed, 0xa1, 0xb1, 0x14, 0x57, 0x10, 0xe0, 0xc0,
+  0x0f, 0xe4, 0x0b, 0x2e, 0xe9, 0x81, 0x0e, 0x05, 0x20, 0x7a, 0x11, 0xae, 0x41, 0xd3, 0x8b, 0x00,
+  0x6a, 0x41, 0x02, 0xf7, 0x7c, 0x84, 0x1f, 0xd7, 0x47, 0xd9, 0xe5, 0xea, 0x57, 0xd2, 0x57, 0xf2,
+  0xd9, 0x72, 0x1c, 0x2e, 0x9e, 0x00, 0xe0, 0x20, 0xca, 0x0a, 0xff, 0x52, 0x6c, 0x25, 0x7d, 0xa5,
+  0x58, 0xab, 0x76, 0x29, 0xf6, 0x6a, 0x7c, 0x53, 0x2d, 0x7a, 0x28, 0x92, 0x05, 0xcc, 0x7d, 0x93,
+  0x47, 0x5e, 0xca, 0x4d, 0x26, 0xdc, 0xce, 0x0d, 0xe2, 0x04, 0x40, 0x81, 0x32, 0x93, 0x34, 0x99,
+  0x22, 0xbe, 0x89, 0x60, 0x47, 0x9e, 0x14, 0x1a, 0x6f, 0x93, 0x81, 0x58, 0x30, 0xd0, 0xc0, 0x9a,
+  0x58, 0x48, 0x0c, 0x5c, 0x1a, 0x4f, 0xaa, 0x6f, 0x82, 0xf3, 0x1e, 0x18, 0xe2, 0x50, 0x86, 0x40,
+  0x86, 0x07, 0xcf, 0x0e, 0x0a, 0x5d, 0x9e, 0x80, 0x20, 0x20, 0x4c, 0x1c, 0x04, 0xd2, 0xc0, 0xe1,
+  0xf9, 0x07, 0xc2, 0x06, 0x42, 0x11, 0xf2, 0x09, 0xd3, 0xe3, 0xf9, 0x07, 0xdc, 0x07, 0xd9, 0x0f,
+  0xc9, 0x81, 0xdc, 0x81, 0x8d, 0x06, 0x44, 0x17, 0x03, 0x76, 0x63, 0xf3, 0xfc, 0x86, 0x02, 0x25,
+  0xb7, 0xaf, 0xc0, 0x94, 0xe9, 0x05, 0xfc, 0x25, 0xac, 0xd5, 0xe4, 0xde, 0x86, 0x97, 0x27, 0x16,
+  0x19, 0x75, 0x50, 0x35, 0x5b, 0x70, 0xbb, 0xbe, 0xc3, 0x8d, 0xd9, 0xa7, 0x6c, 0xc7, 0x32, 0x75,
+  0x64, 0x2f, 0x86, 0x70, 0x1e, 0x8e, 0xfb, 0xa2, 0xc2, 0x1d, 0x81, 0x0c, 0x69, 0xcb, 0x33, 0x72,
+  0xa7, 0x48, 0xc6, 0x9e, 0xd1, 0xe4, 0x81, 0xe9, 0xfd, 0x60, 0x98, 0x08, 0x8a, 0xb0, 0x76, 0x59,
+  0x06, 0x4f, 0x60, 0xaf, 0x88, 0x02, 0x94, 0x6c, 0x79, 0x66, 0x9d, 0x75, 0xd8, 0x14, 0xec, 0x78,
+  0x12, 0x07, 0xb3, 0xf0, 0xac, 0x09, 0xf9, 0x0e, 0xdd, 0x85, 0x55, 0x04, 0x50, 0x06, 0x68, 0xbb,
+  0x05, 0x2b, 0x73, 0xa1, 0x55, 0x41, 0x40, 0x5a, 0x48, 0xda, 0xdb, 0xe0, 0xf9, 0xaf, 0x5f, 0xda,
+  0x36, 0xc5, 0x0d, 0x52, 0x27, 0x04, 0x08, 0x9e, 0x66, 0xa2, 0x5e, 0x77, 0x2a, 0x21, 0xd8, 0x01,
+  0x85, 0x19, 0x52, 0x67, 0xd8, 0x89, 0x6e, 0xd6, 0x65, 0xca, 0xe7, 0x40, 0x77, 0x5d, 0x06, 0x45,
+  0xf0, 0x6a, 0x25, 0xd3, 0xe1, 0x4b, 0x34, 0xf2, 0x42, 0x08, 0xb2, 0xc4, 0x74, 0x5e, 0x84, 0xc4,
+  0x60, 0xfa, 0xae, 0x57, 0xb6, 0xd6, 0x4c, 0x30, 0x6c, 0xf2, 0xe8, 0x16, 0x78, 0xa5, 0x1b, 0x60,
+  0x39, 0x78, 0xae, 0x39, 0x13, 0x0b, 0xa0, 0x3c, 0xae, 0xe9, 0x90, 0x90, 0xcf, 0x6c, 0x70, 0xd6,
+  0xa7, 0xc1, 0x82, 0x54, 0xd6, 0xc2, 0xbc, 0x57, 0xe4, 0x81, 0x62, 0x90, 0xa9, 0xeb, 0x06, 0xe5,
+  0xa2, 0xe4, 0x4a, 0x4d, 0x62, 0x2a, 0x98, 0x01, 0x05, 0xf2, 0x29, 0xf2, 0x38, 0x3c, 0xf5, 0x33,
+  0x2d, 0x88, 0x9c, 0xca, 0x14, 0x22, 0x20, 0x33, 0xca, 0x5e, 0x60, 0x81, 0x26, 0x86, 0x7b, 0x24,
+  0x53, 0xf2, 0x9d, 0xa4, 0x87, 0x94, 0x92, 0xf2, 0x8c, 0x97, 0x72, 0x34, 0x72, 0xbd, 0x9e, 0x70,
+  0xf8, 0x22, 0xe3, 0x85, 0x9e, 0x7a, 0xa4, 0xb7, 0x06, 0xc5, 0x64, 0x84, 0xd8, 0xad, 0xb2, 0x74,
+  0xf4, 0x55, 0x7f, 0xfa, 0xa9, 0x73, 0x7d, 0x06, 0x0f, 0xa9, 0x1a, 0x01, 0x8d, 0x3b, 0x02, 0x38,
+  0x0a, 0x48, 0xc4, 0xb6, 0x3d, 0x72, 0x9c, 0xc8, 0x10, 0x81, 0x06, 0xc2, 0x06, 0xf4, 0xd2, 0xe0,
+  0x76, 0x0f, 0x4d, 0xe1, 0x61, 0x2a, 0xe0, 0xdd, 0x74, 0x08, 0x86, 0x90, 0x6e, 0xd0, 0x4a, 0x51,
+  0x0a, 0x8e, 0xc3, 0xb5, 0xca, 0x7c, 0x9e, 0xc2, 0x8e, 0xc5, 0x89, 0xc6, 0x2f, 0x72, 0x56, 0x1e,
+  0xa6, 0x68, 0x91, 0xa0, 0x39, 0x75, 0x98, 0x32, 0x2c, 0x4c, 0x67, 0x79, 0x55, 0x58, 0x04, 0xd6,
+  0x70, 0x20, 0x84, 0x0e, 0xac, 0x92, 0x07, 0x14, 0x50, 0x45, 0x70, 0x65, 0x60, 0x31, 0x28, 0x53,
+  0x75, 0x28, 0x4c, 0x83, 0x79, 0x46, 0x50, 0xe6, 0xf3, 0x80, 0x0b, 0x31, 0x51, 0x77, 0xf2, 0x87,
+  0x4e, 0x55, 0xb4, 0x80, 0x0d, 0x05, 0x75, 0x59, 0xa4, 0xb4, 0x38, 0x20, 0xec, 0x0d, 0xc1, 0x62,
+  0x60, 0xad, 0x39, 0x56, 0xcd, 0x5a, 0x4a, 0x87, 0x45, 0x54, 0x83, 0xc4, 0x68, 0x29, 0x63, 0x90,
+  0x4f, 0x37, 0x6c, 0x40, 0xf1, 0xc8, 0x2a, 0xe0, 0x02, 0x38, 0xee, 0x0d, 0x5a, 0xfb, 0x24, 0xb4,
+  0x22, 0x09, 0x2b, 0x57, 0x4f, 0x48, 0x83, 0xa1, 0x99, 0x9e, 0x70, 0xb2, 0x60, 0x02, 0xad, 0x51,
+  0x3c, 0x72, 0x06, 0x14, 0x44, 0x3c, 0xa5, 0x6c, 0x01, 0x5f, 0x24, 0x83, 0x55, 0x59, 0x52, 0xe7,
+  0xa2, 0x9b, 0xef, 0x93, 0x33, 0x71, 0xb9, 0x50, 0x44, 0x96, 0x64, 0x97, 0xbe, 0x88, 0x52, 0x56,
+  0xc7, 0xb5, 0x2b, 0x5f, 0x54, 0xe6, 0xa6, 0xa5, 0x2f, 0x12, 0xb9, 0xa9, 0x59, 0xf9, 0x22, 0x24,
+  0xa4, 0xf0, 0x26, 0xa4, 0x12, 0x48, 0x7d, 0xa1, 0x71, 0x94, 0x0b, 0x38, 0xa4, 0x49, 0xd2, 0xdb,
+  0x78, 0xc8, 0x50, 0x2c, 0xcb, 0xae, 0x9c, 0x91, 0xa7, 0x93, 0x08, 0x6a, 0x67, 0xe5, 0xc2, 0xb0,
+  0x7c, 0x62, 0x13, 0xcc, 0xce, 0xae, 0x8b, 0x12, 0xf9, 0xb2, 0x68, 0x20, 0x41, 0x02, 0xd3, 0x5c,
+  0x5a, 0xfe, 0x91, 0xe0, 0x0c, 0x4a, 0xe6, 0x11, 0x3f, 0x20, 0x56, 0xc3, 0xaf, 0x58, 0xef, 0x93,
+  0x9d, 0x13, 0xa7, 0xd0, 0x1b, 0x62, 0xad, 0x50, 0x97, 0x0e, 0xa9, 0x2e, 0xf3, 0x65, 0x4f, 0x5d,
+  0x04, 0x49, 0x84, 0xb9, 0x4e, 0xab, 0x34, 0x2a, 0xc3, 0x91, 0x21, 0x38, 0x35, 0xd8, 0xde, 0xc7,
+  0x84, 0x75, 0x70, 0x44, 0x2c, 0x73, 0x81, 0x06, 0x65, 0x01, 0x70, 0x9c, 0x06, 0x69, 0x02, 0x6c,
+  0x89, 0x62, 0x05, 0x72, 0x5f, 0x72, 0x0e, 0x70, 0x12, 0x2e, 0xc5, 0x84, 0x00, 0xfe, 0xd1, 0x23,
+  0x85, 0x42, 0x8a, 0x8f, 0x74, 0xfa, 0x45, 0x19, 0xf5, 0x80, 0x3e, 0x05, 0x93, 0x1f, 0x78, 0x16,
+  0x61, 0xd6, 0xd1, 0xb0, 0x84, 0x23, 0x93, 0x94, 0x72, 0x75, 0x56, 0x06, 0xc3, 0x52, 0x3f, 0xca,
+  0x60, 0x58, 0xb5, 0xcb, 0xe0, 0x57, 0x0d, 0x2f, 0xcb, 0x92, 0xc5, 0x55, 0x59, 0xea, 0x43, 0x35,
+  0xde, 0xf1, 0xb8, 0xe2, 0x56, 0xf0, 0x45, 0x79, 0x52, 0x06, 0xe3, 0xaa, 0xbd, 0x44, 0xaf, 0x1c,
+  0x5f, 0x96, 0x2d, 0xb8, 0x6b, 0xaf, 0xc6, 0xde, 0x40, 0xd2, 0x14, 0x28, 0xcd, 0x50, 0x28, 0x78,
+  0x67, 0x70, 0x81, 0xaa, 0x49, 0xc4, 0x16, 0x85, 0xa1, 0x09, 0x5f, 0x84, 0x72, 0xae, 0x88, 0xb5,
+  0x2a, 0xcc, 0x24, 0xa0, 0x35, 0x38, 0xca, 0x70, 0x1a, 0xdc, 0xcc, 0x1c, 0x6e, 0x4f, 0x18, 0x80,
+  0xd5, 0x00, 0xe5, 0x2a, 0x48, 0xce, 0x28, 0x0a, 0x21, 0xac, 0x59, 0x41, 0x95, 0xcb, 0x18, 0xb4,
+  0xe8, 0x26, 0x1f, 0x54, 0x96, 0x29, 0x27, 0x86, 0xbe, 0x56, 0x65, 0x89, 0x6e, 0x99, 0x1b, 0x95,
+  0xe4, 0x94, 0xb9, 0x53, 0x49, 0x6e, 0x99, 0x5b, 0xd5, 0xed, 0x22, 0xf7, 0xaa, 0xc7, 0xcb, 0x32,
+  0xfc, 0x3d, 0x7c, 0x50, 0x95, 0x9b, 0x01, 0x8e, 0x53, 0xe1, 0x41, 0xbe, 0x48, 0x48, 0x99, 0xf0,
+  0x24, 0xb6, 0x33, 0xae, 0x2d, 0x04, 0x9e, 0x42, 0x38, 0x91, 0x0b, 0xb4, 0x28, 0xb6, 0xe9, 0x1e,
+  0xed, 0x25, 0x50, 0x19, 0x2e, 0x8d, 0xb5, 0x74, 0x6a, 0xb7, 0x16, 0xd2, 0x5e, 0xcf, 0x69, 0xb5,
+  0x17, 0xdb, 0xb1, 0xe7, 0xc4, 0x0f, 0x08, 0x4e, 0x95, 0xdd, 0xda, 0xe3, 0x85, 0xd1, 0x79, 0x63,
+  0xe4, 0xf8, 0x00, 0x0d, 0x6a, 0xbf, 0xf5, 0xe9, 0x57, 0x67, 0xaf, 0x2c, 0xb3, 0x79, 0x93, 0x84,
+  0x3d, 0xa7, 0xfd, 0xbe, 0x79, 0x38, 0x8d, 0x8e, 0x0f, 0xd6, 0xca, 0xc4, 0x07, 0x98, 0xb9, 0xda,
+  0xf9, 0xaa, 0x0b, 0xf2, 0xd7, 0xad, 0xbd, 0x32, 0x71, 0xb4, 0xd4, 0xb9, 0x57, 0xa6, 0x1c, 0x38,
+  0x0e, 0xba, 0x29, 0x53, 0xce, 0xa5, 0x9a, 0x94, 0xf1, 0x6d, 0xf2, 0xd3, 0x47, 0xd3, 0x22, 0x7e,
+  0x07, 0xf4, 0x44, 0x49, 0x6d, 0x57, 0x60, 0x88, 0xa3, 0x34, 0x3a, 0xfe, 0x1a, 0xb0, 0x78, 0xc6,
+  0x37, 0xf6, 0x56, 0x13, 0xba, 0x7d, 0x32, 0x38, 0x1d, 0x37, 0x88, 0x69, 0xd1, 0x76, 0x2b, 0x4c,
+  0x9e, 0x66, 0x51, 0x2f, 0x3c, 0x04, 0x0a, 0x73, 0xf4, 0xbe, 0x77, 0x14, 0x5e, 0x86, 0xef, 0xfb,
+  0x63, 0xb0, 0x0c, 0xdf, 0xdf, 0x0d, 0x01, 0x96, 0xae, 0xa6, 0x49, 0x3c, 0x7d, 0x7b, 0x32, 0x28,
+  0xd2, 0x8b, 0x8b, 0x04, 0xe4, 0xac, 0x56, 0xe2, 0x34, 0xef, 0x49, 0x54, 0x84, 0x71, 0x92, 0x8f,
+  0xf6, 0xaa, 0x8d, 0xc9, 0xf6, 0xa1, 0xc8, 0x80, 0xf1, 0x3b, 0x4a, 0x27, 0x83, 0x09, 0x41, 0x60,
+  0x45, 0xca, 0xf2, 0x45, 0x7a, 0x79, 0xb0, 0x88, 0x67, 0x74, 0x2f, 0xa8, 0x84, 0xc3, 0x66, 0x02,
+  0x50, 0x17, 0xad, 0xaf, 0xd3, 0x22, 0x4c, 0xfa, 0x53, 0x5b, 0x03, 0xcd, 0xef, 0x93, 0xe3, 0xaf,
+  0xf9, 0x21, 0x6f, 0x04, 0x3b, 0x9d, 0xf5, 0xc7, 0xe5, 0xfc, 0xaa, 0x88, 0x72, 0x65, 0xe4, 0x7d,
+  0x22, 0xf4, 0x2c, 0x5c, 0xcd, 0x92, 0xdb, 0x20, 0x03, 0x11, 0x72, 0x1f, 0x73, 0x77, 0xf6, 0x28,
+  0x22, 0x05, 0xc4, 0x9c, 0x15, 0x8b, 0xb0, 0x60, 0x73, 0x3a, 0x96, 0x60, 0xe1, 0x2a, 0x2d, 0x16,
+  0x51, 0xc6, 0x48, 0xeb, 0x55, 0xf9, 0x66, 0x70, 0x5b, 0x57, 0x6c, 0xb4, 0x88, 0x8b, 0x3d, 0x96,
+  0x66, 0x74, 0xdb, 0xec, 0x2d, 0xbf, 0x1a, 0x06, 0xe0, 0x05, 0xd4, 0x2b, 0x62, 0xa3, 0x65, 0x9c,
+  0xe7, 0x7b, 0x5d, 0x84, 0xbe, 0x4a, 0xd3, 0x84, 0x3d, 0x8b, 0x0b, 0x76, 0xc0, 0x5e, 0xa2, 0x4f,
+  0x7f, 0x82, 0xd7, 0x18, 0x88, 0x71, 0x34, 0xe8, 0x1e, 0x48, 0x25, 0x8f, 0x9a, 0xd3, 0xe5, 0xba,
+  0x8c, 0x85, 0xb3, 0x59, 0x16, 0xe5, 0xf2, 0x3a, 0x1b, 0xbf, 0xe0, 0x16, 0x4e, 0xf1, 0x2f, 0xa7,
+  0x6e, 0x9f, 0x25, 0xa0, 0x2d, 0x9a, 0xb1, 0xcd, 0x1a, 0xce, 0x3d, 0x03, 0x75, 0x82, 0x32, 0xa2,
+  0x9a, 0x13, 0xfb, 0x76, 0x95, 0x5e, 0xae, 0xb8, 0x8b, 0xa2, 0xfb, 0x0f, 0x49, 0xc4, 0x9e, 0x7c,
+  0x73, 0xc6, 0xe6, 0xa4, 0xfc, 0x6c, 0x84, 0x99, 0x93, 0xa8, 0x93, 0x09, 0xd4, 0xa9, 0xe6, 0x01,
+  0x7e, 0x9c, 0x51, 0xd7, 0xfe, 0xbc, 0x98, 0xad, 0xf2, 0x09, 0x21, 0x79, 0x67, 0x46, 0xbc, 0x8e,
+  0x97, 0x11, 0x9b, 0x85, 0x45, 0xc8, 0x2e, 0xc3, 0x18, 0xb2, 0x8f, 0x57, 0x9c, 0x03, 0x6b, 0x8a,
+  0x35, 0xfb, 0x08, 0xff, 0xc8, 0x9e, 0xe8, 0x0a, 0x04, 0xf4, 0x82, 0x68, 0x1b, 0x4d, 0x39, 0xdf,
+  0x7e, 0xfa, 0xfd, 0x3f, 0x30, 0x71, 0xf3, 0x11, 0x98, 0xcb, 0x5f, 0xa8, 0x8e, 0xb7, 0x76, 0xd2,
+  0xfb, 0x22, 0x2c, 0xa2, 0xd5, 0xf4, 0x8a, 0xad, 0x83, 0xa0, 0x3f, 0x91, 0x89, 0x18, 0x74, 0x67,
+  0x1a, 0x9f, 0x72, 0xb9, 0x09, 0x7b, 0x11, 0xb4, 0xc2, 0x6d, 0x11, 0x95, 0x4b, 0x08, 0x30, 0xca,
+  0xf6, 0xd9, 0x32, 0x9a, 0xc5, 0xe1, 0x8a, 0x8d, 0x2e, 0x63, 0x90, 0x7b, 0xc0, 0xe8, 0x47, 0xba,
+  0x29, 0x58, 0x08, 0x36, 0xd0, 0xd9, 0x21, 0xd7, 0x7a, 0xa8, 0x80, 0xe8, 0xce, 0xc4, 0xb1, 0x63,
+  0x27, 0x99, 0x62, 0xa6, 0xc7, 0x70, 0x13, 0x6c, 0xed, 0xe8, 0xb7, 0x08, 0x2a, 0x34, 0x8e, 0x86,
+  0xdd, 0x8b, 0x3c, 0x73, 0x7e, 0x1b, 0x4e, 0x71, 0x9c, 0xec, 0x32, 0xca, 0x60, 0x9b, 0x29, 0x70,
+  0x83, 0x97, 0x81, 0xf1, 0x9e, 0x6f, 0xe2, 0x04, 0x9a, 0x5c, 0x90, 0xf0, 0xc1, 0x8b, 0x2c, 0x9a,
+  0xf2, 0x6b, 0x5c, 0x95, 0x05, 0x53, 0x43, 0x27, 0x81, 0xdf, 0x6e, 0x8a, 0xf0, 0x22, 0xba, 0x85,
+  0xd1, 0xa6, 0x62, 0xc0, 0xfd, 0xe8, 0xa9, 0x54, 0x4e, 0xa0, 0x1b, 0x21, 0x77, 0x38, 0xc8, 0x23,
+  0x10, 0x33, 0x05, 0xad, 0x39, 0xe9, 0x28, 0xfb, 0xfa, 0x31, 0x9c, 0x56, 0x76, 0x19, 0x66, 0x33,
+  0xc8, 0x6a, 0x34, 0x8b, 0xd1, 0xad, 0x38, 0x2c, 0x3b, 0xcf, 0xe8, 0xc0, 0x3a, 0xa4, 0xe3, 0x3b,
+  0x40, 0x91, 0xe2, 0x97, 0xbd, 0xe9, 0xa6, 0xcc, 0xf9, 0x66, 0x0e, 0x97, 0x9e, 0xef, 0xa3, 0x17,
+  0xd0, 0x9d, 0xd1, 0x3d, 0xd8, 0x2c, 0xdd, 0x5c, 0x2c, 0xa0, 0x03, 0xd3, 0x74, 0x7d, 0xd5, 0x2d,
+  0x6c, 0x31, 0x1c, 0x99, 0x57, 0x5e, 0xdc, 0x42, 0xd4, 0x62, 0x14, 0x0d, 0xba, 0xbb, 0x62, 0x93,
+  0x57, 0x46, 0x06, 0xb9, 0x86, 0xd2, 0x26, 0x61, 0x06, 0x3e, 0x17, 0xc2, 0x53, 0xf3, 0xa3, 0x78,
+  0x36, 0x4a, 0xd2, 0x4b, 0xaa, 0xca, 0xe3, 0x15, 0x0c, 0xf4, 0x3c, 0x4d, 0xbb, 0x95, 0xf6, 0x19,
+  0x00, 0xf4, 0xc7, 0x9f, 0xa6, 0xbb, 0x33, 0xe2, 0x2f, 0xa3, 0x65, 0x9a, 0x5d, 0x71, 0xa9, 0x29,
+  0x41, 0x25, 0x4f, 0x52, 0x08, 0x8c, 0xbc, 0x10, 0x3f, 0x82, 0x7d, 0x5f, 0xd0, 0x1d, 0x67, 0x58,
+  0xdc, 0x2a, 0x4c, 0xd8, 0x77, 0x8f, 0x5e, 0xee, 0xb1, 0x87, 0xbc, 0x71, 0x5b, 0x6c, 0xcd, 0x7e,
+  0xe4, 0x9a, 0x5f, 0x9d, 0xd1, 0x80, 0xce, 0x54, 0xab, 0x9e, 0xfa, 0x0c, 0xf3, 0xf5, 0x27, 0x9c,
+  0xb0, 0x13, 0x83, 0xef, 0x33, 0xec, 0x7f, 0xbf, 0x26, 0x5b, 0xeb, 0x8f, 0xc5, 0x86, 0xf7, 0xbf,
+  0x4f, 0x0c, 0x9e, 0xbf, 0x62, 0x8f, 0x44, 0x00, 0xec, 0x8f, 0x45, 0xbc, 0xa6, 0x21, 0x37, 0x60,
+  0xd1, 0x2c, 0x10, 0x20, 0x1a, 0xca, 0x2f, 0x81, 0x9c, 0x89, 0x85, 0x45, 0x99, 0x64, 0x56, 0x57,
+  0x17, 0xc4, 0x75, 0x21, 0xf5, 0x6a, 0x85, 0xb8, 0x28, 0xd1, 0xb8, 0x06, 0xbe, 0x4c, 0x57, 0x29,
+  0x5d, 0xc3, 0x8b, 0xb6, 0x2e, 0x0d, 0x0c, 0x4e, 0xaf, 0x5b, 0xd4, 0x34, 0xb3, 0x49, 0x99, 0xea,
+  0x0e, 0xd4, 0x3b, 0x03, 0x74, 0xea, 0xbf, 0x03, 0xa7, 0xf6, 0x65, 0x34, 0x7d, 0x1b, 0xcd, 0xee,
+  0x75, 0x92, 0x98, 0x4d, 0x5d, 0x23, 0x2d, 0xcc, 0xd3, 0x3f, 0xfd, 0xf1, 0x0f, 0x7f, 0xcb, 0xea,
+  0xd4, 0x8d, 0x49, 0x64, 0xb0, 0xb8, 0x33, 0x5b, 0x32, 0x6c, 0x22, 0xfd, 0x22, 0xce, 0x6b, 0x0c,
+  0x7b, 0x33, 0x45, 0x95, 0xe7, 0x67, 0xe3, 0xb1, 0x3a, 0xb1, 0xcc, 0xd3, 0x11, 0xf2, 0x10, 0x31,
+  0xce, 0x11, 0xb5, 0xd2, 0xf5, 0x86, 0xc2, 0xee, 0x0c, 0x6e, 0x05, 0x21, 0x43, 0x5c, 0xe8, 0xbf,
+  0xc5, 0xe2, 0x91, 0x6e, 0x84, 0x21, 0x9c, 0x22, 0x7e, 0x02, 0xef, 0x57, 0xdf, 0x9e, 0xbd, 0x1e,
+  0xb0, 0x90, 0xcf, 0x74, 0x32, 0x38, 0xc8, 0xc3, 0x77, 0xd1, 0x16, 0xbb, 0xfb, 0xf3, 0xec, 0xa7,
+  0x7f, 0xfa, 0xcf, 0xff, 0xe7, 0x7f, 0xfd, 0x9d, 0x5c, 0x0b, 0x9f, 0x89, 0xcc, 0xed, 0x4c, 0xbe,
+  0x54, 0xe8, 0x60, 0x9c, 0x84, 0x55, 0x5f, 0x51, 0xeb, 0xd0, 0x7d, 0x72, 0x25, 0x94, 0x48, 0x03,
+  0xa2, 0x00, 0x38, 0x38, 0x6d, 0x80, 0xbf, 0xc6, 0x2e, 0xf8, 0x05, 0x33, 0xa6, 0xdc, 0xee, 0x93,
+  0x39, 0x79, 0x0d, 0x4a, 0x3e, 0x1d, 0x69, 0x54, 0x65, 0xd1, 0x6f, 0x36, 0x88, 0x4b, 0xb3, 0x5e,
+  0x76, 0xdb, 0x17, 0xf5, 0x57, 0xf4, 0x30, 0xa5, 0x89, 0x38, 0x55, 0xdd, 0x84, 0xb5, 0xbc, 0x6f,
+  0x58, 0xe3, 0xcd, 0xe1, 0xa8, 0x58, 0x8b, 0x8a, 0x12, 0x67, 0xba, 0x1e, 0x7c, 0x32, 0x30, 0x06,
+  0xf4, 0x64, 0xe0, 0x64, 0xe0, 0x3a, 0x8e, 0xe5, 0x0c, 0xae, 0xd7, 0x8e, 0x5b, 0x98, 0xc3, 0xdf,
+  0xfd, 0x1b, 0x7b, 0x91, 0x22, 0x94, 0xb3, 0x97, 0x22, 0xc7, 0x7a, 0x22, 0x92, 0xca, 0x7b, 0x91,
+  0xaf, 0x48, 0xdb, 0xa4, 0x2c, 0x07, 0xa7, 0xcd, 0x19, 0xae, 0xf7, 0x7e, 0xdd, 0x52, 0x6e, 0x02,
+  0x94, 0x1c, 0x6b, 0x55, 0x56, 0x5c, 0x5b, 0x87, 0x74, 0x6f, 0x18, 0x9c, 0xfb, 0x8f, 0xa3, 0x2f,
+  0x0f, 0x7f, 0xd4, 0xc7, 0xc1, 0x9b, 0x0f, 0xc6, 0xbe, 0xf5, 0xf1, 0xaf, 0xb4, 0xbd, 0x0f, 0xd6,
+  0xc7, 0xba, 0xfc, 0x1f, 0x06, 0xf7, 0xa5, 0x13, 0x02, 0x11, 0xa1, 0x14, 0x4d, 0x5a, 0x6f, 0xab,
+  0x15, 0x0a, 0xa4, 0x06, 0x91, 0xbf, 0xa0, 0x5e, 0xfc, 0xe1, 0xef, 0xd9, 0xf3, 0x19, 0x2d, 0x3e,
+  0xe6, 0xf1, 0x54, 0xbe, 0x91, 0xba, 0x83, 0x26, 0x6c, 0x56, 0xf1, 0x6f, 0x36, 0xd1, 0x73, 0xac,
+  0xdb, 0xbf, 0xe7, 0xbf, 0xb1, 0xe7, 0x4f, 0xd8, 0xe8, 0x2a, 0xdd, 0x80, 0x43, 0xb4, 0x20, 0x93,
+  0xeb, 0xc0, 0xbd, 0xfe, 0x9a, 0x50, 0x01, 0x94, 0xfc, 0xa9, 0xcb, 0xf7, 0x6d, 0xe9, 0x4b, 0xac,
+  0xf8, 0x9e, 0x21, 0x67, 0xa4, 0x79, 0x06, 0xa7, 0x4b, 0xbe, 0x7e, 0x94, 0x45, 0xb1, 0x6e, 0xa1,
+  0x05, 0x8b, 0x96, 0x90, 0x0d, 0xdd, 0x02, 0xff, 0x06, 0xd4, 0x52, 0xc6, 0x8d, 0xba, 0x6d, 0x3d,
+  0xfe, 0x31, 0x1c, 0xff, 0x16, 0x6a, 0xfb, 0x57, 0xe3, 0x37, 0x0f, 0x9b, 0xd8, 0xe6, 0x4b, 0x5a,
+  0x76, 0x94, 0xfb, 0x46, 0xd7, 0xdf, 0x62, 0x3c, 0xda, 0x75, 0x6d, 0x94, 0x47, 0x53, 0xba, 0xb9,
+  0xda, 0x80, 0xcd, 0xd8, 0xa3, 0xe9, 0x94, 0x96, 0xe8, 0x72, 0xb1, 0x19, 0x16, 0x98, 0x6e, 0x8d,
+  0x25, 0x5b, 0x7b, 0x36, 0x79, 0x75, 0x7c, 0xfb, 0xa6, 0xfd, 0xe0, 0x54, 0xde, 0xc2, 0x13, 0xe3,
+  0x4a, 0xe2, 0xbf, 0xe1, 0xec, 0x3c, 0x3e, 0xa0, 0xca, 0x53, 0xc1, 0x3e, 0x59, 0x50, 0x29, 0x3b,
+  0xe0, 0xa4, 0xdd, 0x9f, 0x52, 0xff, 0x27, 0xf2, 0x39, 0xfc, 0x72, 0x75, 0xe5, 0xf1, 0xda, 0x2e,
+  0x6e, 0xdd, 0x87, 0x91, 0xd6, 0x8e, 0xab, 0xf6, 0x0d, 0xde, 0x7d, 0xcb, 0x37, 0x70, 0x84, 0xe5,
+  0xe6, 0x2c, 0xa5, 0x25, 0x54, 0x9c, 0xb3, 0x55, 0x54, 0x5c, 0xa6, 0xd9, 0xdb, 0x7d, 0x16, 0x85,
+  0x53, 0x2c, 0xf1, 0x37, 0xe7, 0x49, 0x9c, 0x2f, 0x20, 0x66, 0xb9, 0xc4, 0x12, 0xeb, 0xfc, 0xcd,
+  0x8a, 0xde, 0xb7, 0x50, 0xce, 0x4d, 0x7b, 0x1c, 0x9b, 0xd2, 0x66, 0x34, 0xf6, 0x22, 0x42, 0x2c,
+  0xe7, 0x1d, 0xab, 0x4a, 0x16, 0x2d, 0xd7, 0xc5, 0x95, 0x58, 0x4d, 0x2e, 0xb1, 0x9a, 0xa4, 0x5d,
+  0x20, 0x4d, 0xe1, 0xd8, 0xba, 0x23, 0xb1, 0xe1, 0xb9, 0xe0, 0x77, 0xe9, 0x65, 0xbe, 0x9d, 0xa3,
+  0x7c, 0xbb, 0xc2, 0x3a, 0x2f, 0xbd, 0xe4, 0x79, 0x7a, 0x58, 0x33, 0x8b, 0x8f, 0xa8, 0x5f, 0x39,
+  0x26, 0x69, 0x38, 0x13, 0x1b, 0xdf, 0xa3, 0xbd, 0x1b, 0x93, 0x95, 0xfe, 0x99, 0xc6, 0xbf, 0xfc,
+  0x33, 0x65, 0x1a, 0x8f, 0x66, 0xef, 0x42, 0x2c, 0x9c, 0x66, 0xb7, 0x8a, 0x42, 0xac, 0x79, 0x27,
+  0x7c, 0xb0, 0xd3, 0x08, 0xab, 0x5b, 0xe9, 0x62, 0x3f, 0x07, 0x4b, 0xf2, 0x8b, 0xd2, 0x02, 0x65,
+  0x81, 0xe7, 0xdb, 0xb0, 0xd6, 0x0c, 0x59, 0xf7, 0x2e, 0xb7, 0x20, 0xba, 0x9e, 0x7e, 0xb5, 0x0a,
+  0xcf, 0x69, 0xeb, 0x89, 0x4a, 0x08, 0xa4, 0x17, 0x50, 0x88, 0x8b, 0x2d, 0x2f, 0x70, 0xc7, 0x54,
+  0x23, 0x14, 0xd7, 0x75, 0x91, 0x69, 0xd4, 0xe9, 0x23, 0xad, 0xa0, 0xb0, 0xfa, 0x6a, 0xed, 0x0e,
+  0xe6, 0x7c, 0x97, 0x61, 0x5a, 0xee, 0x26, 0xa6, 0x17, 0x11, 0xa9, 0xe0, 0x3e, 0xdb, 0xe4, 0x60,
+  0x66, 0x38, 0xa7, 0x88, 0x14, 0x42, 0x4b, 0xf8, 0x13, 0xc8, 0xbd, 0x5b, 0xa5, 0x29, 0x25, 0x0e,
+  0x65, 0x96, 0x52, 0x95, 0x9b, 0xc1, 0xc8, 0xbc, 0xb7, 0x60, 0x2a, 0x16, 0x98, 0x67, 0x30, 0xb7,
+  0x41, 0xb9, 0xde, 0xa7, 0x75, 0xe7, 0x63, 0x5e, 0xcd, 0x46, 0x7c, 0x43, 0x98, 0xeb, 0xa8, 0xd8,
+  0x6e, 0x20, 0x9e, 0x34, 0x17, 0xb5, 0xf7, 0x40, 0xb5, 0x82, 0x83, 0xa4, 0x5b, 0xad, 0xb9, 0xef,
+  0x40, 0x43, 0xbb, 0xac, 0x2f, 0xe3, 0x15, 0x6d, 0x2d, 0x20, 0x7f, 0x88, 0x57, 0xf1, 0x72, 0xb3,
+  0x64, 0x7c, 0xa3, 0x41, 0xd9, 0x6a, 0x46, 0xc8, 0x09, 0x91, 0xe8, 0x53, 0xdf, 0x5b, 0x91, 0xa2,
+  0x02, 0x97, 0xb4, 0x34, 0xaa, 0xda, 0x39, 0xc5, 0xbd, 0x12, 0x15, 0xbe, 0x97, 0x44, 0x85, 0xef,
+  0x77, 0x10, 0x05, 0x20, 0x97, 0xa4, 0xb0, 0x24, 0xe6, 0x5c, 0xf8, 0xc9, 0xcb, 0x45, 0xb4, 0xaa,
+  0x54, 0x39, 0xcc, 0xb2, 0xf8, 0x1d, 0xdf, 0x86, 0x3a, 0xdf, 0x64, 0x79, 0x91, 0xdf, 0x9e, 0x76,
+  0x89, 0x83, 0x4a, 0x7b, 0x59, 0xf5, 0xb3, 0xd1, 0x4e, 0xbb, 0x7b, 0x9c, 0xc8, 0xc1, 0xe9, 0xab,
+  0xc6, 0x7e, 0xa6, 0xcc, 0x0e, 0xcf, 0xf8, 0x7e, 0x66, 0x97, 0x19, 0xf3, 0x83, 0x00, 0x59, 0xd1,
+  0xdc, 0x33, 0x25, 0x1e, 0x84, 0xc2, 0x3f, 0xee, 0x33, 0x9d, 0x9d, 0xb0, 0x74, 0x3e, 0xbf, 0x1d,
+  0x37, 0x6a, 0xac, 0x4a, 0x66, 0x28, 0x35, 0x4d, 0x5e, 0xe8, 0xb7, 0xe5, 0xc5, 0x27, 0x3a, 0x61,
+  0x1e, 0xf4, 0xbe, 0x49, 0x9f, 0x44, 0xc8, 0x4b, 0x1a, 0x0b, 0xa1, 0xaa, 0xae, 0x8f, 0x4b, 0x6e,
+  0x8c, 0x90, 0xcb, 0x32, 0x85, 0xa9, 0x87, 0x8c, 0x6f, 0x5b, 0x8a, 0x64, 0x69, 0x9e, 0x85, 0x7c,
+  0xbb, 0x96, 0xce, 0x4c, 0x90, 0xd6, 0x8c, 0x5e, 0x4f, 0x5e, 0xfd, 0xf5, 0x37, 0xdf, 0x3e, 0xf9,
+  0xea, 0xc5, 0xa3, 0x5f, 0xed, 0xdd, 0xc6, 0x7f, 0xd7, 0x2f, 0x61, 0x06, 0xbb, 0x76, 0x6f, 0x76,
+  0x68, 0x4a, 0x07, 0xee, 0x5f, 0x87, 0xcf, 0x67, 0x09, 0xe8, 0xfb, 0x3a, 0x8a, 0xd6, 0x61, 0x42,
+  0x0a, 0x2f, 0xbc, 0xd7, 0x28, 0xbf, 0x56, 0xd4, 0x37, 0x2d, 0x2f, 0x25, 0x58, 0x95, 0xaf, 0x65,
+  0x55, 0x5b, 0xdc, 0x62, 0x29, 0xe1, 0x99, 0xba, 0xde, 0x24, 0xa7, 0xc9, 0x80, 0x3b, 0xd0, 0xb7,
+  0x2a, 0xde, 0x25, 0x64, 0x0d, 0xe9, 0x79, 0xc4, 0xe8, 0xfb, 0x07, 0x57, 0x20, 0xee, 0x13, 0x69,
+  0xe2, 0xa0, 0x5a, 0x44, 0x89, 0xba, 0x1d, 0x0b, 0xa4, 0x9f, 0x8b, 0x28, 0x79, 0x26, 0xcc, 0x89,
+  0xca, 0x3f, 0x89, 0x16, 0x01, 0xa1, 0x49, 0x8b, 0xac, 0xeb, 0xa6, 0xc5, 0xfc, 0x59, 0x48, 0x39,
+  0x5b, 0xcd, 0x10, 0x5f, 0x07, 0xa7, 0x67, 0x64, 0x27, 0xe7, 0x6a, 0xa4, 0x15, 0xfa, 0x37, 0x8b,
+  0xe6, 0xe1, 0x26, 0x29, 0x3e, 0x45, 0x5e, 0x12, 0x74, 0x63, 0x6b, 0x46, 0x56, 0x75, 0xeb, 0x60,
+  0x7b, 0x39, 0xbb, 0x6d, 0x85, 0x3f, 0xa3, 0x3f, 0xc2, 0x62, 0xa7, 0xe5, 0x8d, 0xd4, 0x9a, 0x7e,
+  0xe9, 0x61, 0xd5, 0xbf, 0xdc, 0x0b, 0xf8, 0xff, 0xc5, 0x15, 0x01, 0xf5, 0xfb, 0x77, 0x44, 0x35,
+  0xd0, 0x9a, 0xa1, 0xbf, 0xb8, 0x13, 0x12, 0x73, 0xde, 0x83, 0x0b, 0x52, 0x00, 0x35, 0xc8, 0xf9,
+  0x65, 0xdd, 0x0f, 0x9f, 0xf3, 0x0e, 0xce, 0x47, 0x19, 0xaf, 0x52, 0xf1, 0xcb, 0x3a, 0x1e, 0x4c,
+  0xf9, 0xf3, 0xb8, 0x9d, 0x1a, 0x70, 0x4d, 0xdc, 0x2f, 0xe1, 0x72, 0x76, 0xdc, 0x32, 0xe2, 0x89,
+  0x6f, 0x7b, 0x01, 0x77, 0xc8, 0x94, 0x4d, 0x11, 0xba, 0x5c, 0xd4, 0xbc, 0x52, 0xc2, 0xb7, 0x43,
+  0xd8, 0x68, 0x9a, 0x2e, 0xd7, 0x71, 0x12, 0x8d, 0xf9, 0xa1, 0xb1, 0xfc, 0x44, 0x50, 0x67, 0xca,
+  0x27, 0x6a, 0x94, 0x49, 0x26, 0xe4, 0xd5, 0xc4, 0x95, 0x34, 0x38, 0x2d, 0x75, 0x36, 0xee, 0xef,
+  0xca, 0x86, 0x7a, 0xb2, 0xbc, 0xef, 0x6c, 0x77, 0xdc, 0x88, 0xf9, 0xdb, 0xff, 0xc6, 0xbe, 0x11,
+  0xfb, 0x20, 0xbf, 0xc4, 0x1a, 0x1f, 0x0b, 0xc1, 0x27, 0xcf, 0x26, 0xaf, 0xaa, 0xbd, 0xc2, 0xb2,
+  0xa8, 0x3a, 0x72, 0x72, 0xbe, 0xfc, 0x53, 0x4c, 0xe5, 0xdd, 0x2c, 0x3a, 0x29, 0x8b, 0xa7, 0xcf,
+  0x5f, 0x3d, 0x8d, 0xa3, 0x64, 0x46, 0x17, 0xb3, 0x76, 0xee, 0x6d, 0x4a, 0x70, 0xa7, 0xdf, 0xe7,
+  0x11, 0xa3, 0xdf, 0x18, 0xff, 0xb2, 0xc7, 0x92, 0x86, 0xd3, 0x2e, 0xf7, 0x54, 0xbd, 0x1f, 0xd8,
+  0xcf, 0xa3, 0xf3, 0x53, 0xcf, 0xc6, 0xfc, 0x77, 0x73, 0xe9, 0x25, 0x2c, 0xd8, 0x58, 0x51, 0xa2,
+  0xb5, 0x7b, 0xf3, 0x7d, 0xe7, 0xa6, 0x65, 0x05, 0x46, 0x32, 0xb2, 0x2e, 0xf7, 0xde, 0x6b, 0x67,
+  0xeb, 0x24, 0x9c, 0x46, 0x8b, 0x34, 0x99, 0x45, 0xc0, 0xcb, 0x08, 0x4c, 0xcd, 0xa0, 0xd7, 0x0b,
+  0x9a, 0x71, 0xef, 0xde, 0xf1, 0x22, 0x2c, 0xa2, 0x4b, 0x0a, 0xbf, 0x7f, 0x21, 0x7e, 0xf9, 0x14,
+  0x82, 0x4b, 0x18, 0x92, 0xde, 0xaa, 0x78, 0x77, 0x72, 0xef, 0x99, 0xd8, 0x7c, 0x73, 0xbe, 0x8a,
+  0x10, 0x06, 0xce, 0xf8, 0x4f, 0x5a, 0x5f, 0xbe, 0xbd, 0x95, 0x60, 0xc5, 0xf0, 0x52, 0xac, 0xb2,
+  0xf4, 0x89, 0x54, 0x9a, 0x0e, 0x5d, 0x80, 0x17, 0xff, 0xbf, 0xf7, 0x68, 0x41, 0x9e, 0x91, 0xb6,
+  0xe0, 0xc5, 0x71, 0xdb, 0x6d, 0x68, 0xa4, 0xa1, 0x65, 0x24, 0xa0, 0x5f, 0x3f, 0x91, 0x3a, 0x5f,
+  0xe3, 0xff, 0xf5, 0x0e, 0x13, 0xbb, 0x7d, 0xa3, 0xfa, 0xc1, 0x03, 0xd5, 0x41, 0x8a, 0x7a, 0x89,
+  0x3f, 0x64, 0xb1, 0x8c, 0x8b, 0xea, 0xf0, 0x96, 0x3e, 0xf4, 0xa5, 0x7c, 0xb1, 0x6a, 0x00, 0x57,
+  0xfa, 0x0f, 0xff, 0x9b, 0x9d, 0xd1, 0x9e, 0x70, 0xeb, 0x83, 0x76, 0x02, 0xca, 0x2e, 0xb0, 0xa2,
+  0xb0, 0x05, 0xb6, 0xfa, 0xba, 0x94, 0x72, 0x53, 0x95, 0xb6, 0xe6, 0x09, 0xa4, 0x96, 0x45, 0xb4,
+  0xe9, 0x4b, 0x8e, 0xf0, 0x4f, 0x7f, 0xfc, 0xc3, 0x7f, 0x61, 0xdf, 0xf1, 0x62, 0x7b, 0xa2, 0xc6,
+  0xf1, 0x34, 0x89, 0xb4, 0xe3, 0x72, 0xb3, 0xf8, 0x50, 0x43, 0x45, 0xf2, 0x0f, 0x51, 0x96, 0x53,
+  0xb0, 0xaa, 0x83, 0xd3, 0x3b, 0x51, 0xa3, 0xc4, 0xc0, 0x31, 0xeb, 0xfc, 0x88, 0xdf, 0xbf, 0xff,
+  0x0f, 0x66, 0xea, 0xa6, 0xf3, 0xa0, 0x31, 0x73, 0xcd, 0xf1, 0xe3, 0x7c, 0x9a, 0xc5, 0xeb, 0x42,
+  0x4c, 0x94, 0x44, 0x05, 0xdb, 0xba, 0x84, 0xf0, 0x43, 0x9c, 0xc7, 0xb4, 0x7f, 0x7b, 0xc2, 0xe6,
+  0x61, 0x92, 0xcb, 0xcf, 0x6d, 0x51, 0x4f, 0xba, 0x8c, 0xa5, 0xdc, 0xce, 0xa5, 0xab, 0x6b, 0x27,
+  0x6c, 0xb5, 0x49, 0x92, 0x66, 0x97, 0xc7, 0xd5, 0x7e, 0x20, 0x9a, 0xf5, 0x23, 0x41, 0xeb, 0x7c,
+  0xb3, 0x12, 0xe1, 0xb7, 0xb1, 0x49, 0xfe, 0x41, 0x92, 0x3b, 0x8f, 0x8a, 0xe9, 0x62, 0x34, 0x94,
+  0xdf, 0xf5, 0x1b, 0xee, 0x55, 0x12, 0xd2, 0x8a, 0x45, 0xb4, 0x1a, 0xc1, 0x45, 0xad, 0x11, 0xff,
+  0x01, 0xef, 0x94, 0x95, 0xbf, 0x6b, 0x7f, 0x93, 0xa7, 0xab, 0xd1, 0x5e, 0xbb, 0xab, 0x80, 0x40,
+  0x1d, 0x3f, 0x28, 0xca, 0xf8, 0xe3, 0x50, 0x39, 0xf8, 0x1e, 0xee, 0xb3, 0x61, 0x75, 0xa2, 0x4c,
+  0x05, 0xf5, 0x8c, 0x69, 0xb8, 0xaf, 0xda, 0xcd, 0xb0, 0xdc, 0xd3, 0xa5, 0x6e, 0xf5, 0x3e, 0x27,
+  0x95, 0x94, 0x9d, 0xc2, 0xaa, 0x28, 0x36, 0xcf, 0x78, 0xb1, 0xda, 0x3e, 0xa2, 0x52, 0x19, 0x13,
+  0xe8, 0x77, 0xe9, 0x2f, 0x79, 0x35, 0xf7, 0x29, 0xf4, 0x1b, 0x10, 0x18, 0xbe, 0xa1, 0x0f, 0xd8,
+  0x7c, 0x15, 0x82, 0x0f, 0xfc, 0x18, 0xad, 0x45, 0x01, 0x63, 0xb3, 0x74, 0xba, 0x59, 0x46, 0xab,
+  0x42, 0xbb, 0x88, 0x8a, 0xaf, 0x92, 0x88, 0x7e, 0x7d, 0x7c, 0xf5, 0x7c, 0xc6, 0x7b, 0xef, 0xc9,
+  0xcf, 0x3c, 0x9d, 0xc8, 0xc0, 0xfa, 0x23, 0x55, 0xbe, 0x51, 0xbf, 0xb7, 0xf2, 0x71, 0x4f, 0x2d,
+  0x1d, 0x1c, 0xb0, 0xef, 0xe8, 0xec, 0x02, 0xa9, 0x64, 0x9c, 0xcb, 0x8d, 0xb4, 0x78, 0x55, 0xdd,
+  0x40, 0xa4, 0x0a, 0x71, 0xd3, 0x36, 0x5d, 0x61, 0x15, 0x86, 0x09, 0x69, 0xb3, 0x38, 0xbd, 0xe4,
+  0xc7, 0x33, 0x0d, 0xb6, 0x96, 0x47, 0x8c, 0x9c, 0x8d, 0xea, 0x99, 0x73, 0x5d, 0xc1, 0xb9, 0x7c,
+  0x9f, 0xc4, 0x89, 0x2f, 0xb7, 0xe4, 0x3f, 0xea, 0x6f, 0x6e, 0x22, 0x93, 0x2e, 0x83, 0x7f, 0x57,
+  0x9e, 0xea, 0x48, 0xd5, 0xd8, 0xea, 0x20, 0x36, 0x1c, 0x61, 0x3b, 0x73, 0x64, 0x78, 0x23, 0xa1,
+  0x19, 0xc0, 0x5e, 0xce, 0x25, 0xf4, 0x46, 0xdc, 0xb1, 0xbc, 0x61, 0x24, 0x72, 0xe9, 0x7a, 0x9c,
+  0x38, 0x1a, 0xec, 0x18, 0xb8, 0x8b, 0xd2, 0x21, 0x3f, 0x3c, 0x19, 0xee, 0x89, 0xcf, 0xf8, 0x20,
+  0x0d, 0x3f, 0xa9, 0x41, 0xa1, 0xa1, 0x17, 0x08, 0x99, 0x75, 0x75, 0x01, 0x91, 0x4d, 0xbd, 0xc0,
+  0x54, 0x4a, 0xbf, 0xa7, 0x21, 0x01, 0xaf, 0x61, 0x34, 0xb3, 0xf1, 0x5e, 0xa0, 0x14, 0x9b, 0x01,
+  0x30, 0xa8, 0x58, 0x05, 0x4c, 0xb4, 0xc0, 0x82, 0x3e, 0x01, 0x8e, 0x8a, 0x94, 0x84, 0x13, 0xbe,
+  0xef, 0x05, 0x47, 0xb5, 0xda, 0x16, 0xa0, 0x92, 0x6a, 0xf8, 0x55, 0xa3, 0x3f, 0x2c, 0x69, 0xf2,
+  0x77, 0x86, 0x55, 0xfb, 0x8b, 0x1d, 0xa0, 0x7a, 0x81, 0x29, 0x0f, 0x91, 0x01, 0x84, 0x82, 0xfc,
+  0x44, 0x7e, 0x8e, 0xa7, 0x96, 0xa0, 0xe2, 0xe9, 0xfa, 0x01, 0x94, 0xaf, 0x3b, 0x76, 0x01, 0xbc,
+  0x1d, 0x76, 0x0d, 0xfd, 0xd9, 0x89, 0xe3, 0xed, 0xb5, 0xac, 0xb1, 0x70, 0xdb, 0x89, 0xaa, 0xda,
+  0xa9, 0x17, 0x58, 0x19, 0x72, 0x77, 0x01, 0x94, 0xcd, 0x2a, 0xa8, 0xee, 0x55, 0x52, 0xdd, 0xe3,
+  0xa3, 0x12, 0xae, 0x90, 0x41, 0xc0, 0x1d, 0x46, 0x59, 0x46, 0xde, 0x10, 0x20, 0xf3, 0x34, 0x89,
+  0x34, 0x14, 0xd3, 0x6c, 0x34, 0x14, 0x01, 0x92, 0xc7, 0x4a, 0x7e, 0x7b, 0x3f, 0x9a, 0x1d, 0xc2,
+  0xb5, 0xa0, 0x71, 0xaf, 0xfa, 0x76, 0x66, 0x33, 0xaa, 0x76, 0x7a, 0xba, 0xca, 0xc7, 0x52, 0x64,
+  0xa6, 0x0f, 0x0d, 0x03, 0xf7, 0xe1, 0xb0, 0xc4, 0x06, 0x0e, 0x99, 0x8d, 0xa8, 0x05, 0x08, 0x40,
+  0x4b, 0xf1, 0xe3, 0x58, 0x11, 0x01, 0x07, 0x96, 0xa3, 0xf6, 0xe1, 0xc3, 0x3d, 0xc5, 0x57, 0x13,
+  0x9e, 0x85, 0x38, 0xf7, 0xde, 0xf2, 0xc7, 0xd9, 0x1b, 0xf6, 0xbb, 0xdf, 0xb1, 0x0f, 0xac, 0x8c,
+  0x09, 0x87, 0x98, 0x6c, 0x9f, 0x35, 0xa2, 0x82, 0x5a, 0x45, 0x71, 0x81, 0x7f, 0xbe, 0xce, 0x60,
+  0x1f, 0x6b, 0x0e, 0x71, 0x34, 0x1f, 0x02, 0xcf, 0x1d, 0x8b, 0xdd, 0xea, 0xab, 0x5d, 0x83, 0xd3,
+  0x61, 0xd7, 0xa8, 0xed, 0x3c, 0x57, 0xa4, 0xb7, 0x7c, 0xdc, 0x90, 0x3d, 0x04, 0x99, 0x0f, 0xd9,
+  0x90, 0xee, 0xc4, 0x34, 0x32, 0xd8, 0xea, 0x06, 0x4e, 0xb5, 0x00, 0xa6, 0xbe, 0x51, 0x0e, 0xfd,
+  0x8e, 0x9e, 0xbd, 0x7e, 0xf9, 0x62, 0xc4, 0xc7, 0x6b, 0x25, 0x69, 0x74, 0xf9, 0x77, 0x78, 0x27,
+  0x0c, 0xf8, 0x8d, 0xd5, 0x26, 0x0e, 0x72, 0x4b, 0x14, 0xcb, 0xd0, 0xb0, 0xbc, 0xb7, 0xb5, 0x2b,
+  0x1f, 0xef, 0x48, 0xc8, 0xaf, 0x43, 0xbb, 0x21, 0x83, 0xbe, 0xb8, 0x97, 0xfb, 0x46, 0x5d, 0xd8,
+  0x8b, 0x3b, 0x57, 0x1d, 0x57, 0xad, 0x54, 0x34, 0xd4, 0xb9, 0x69, 0xc0, 0x35, 0xf3, 0xf2, 0xec,
+  0xb4, 0x6a, 0xf9, 0xf8, 0xe0, 0x06, 0xc3, 0xac, 0x6e, 0x6a, 0xc0, 0x34, 0x63, 0xb8, 0x8a, 0x8c,
+  0x68, 0x85, 0x3e, 0x12, 0xc0, 0x6e, 0xfb, 0x50, 0x58, 0x42, 0x32, 0xa9, 0x55, 0x3a, 0x8b, 0x8a,
+  0x4d, 0xb6, 0x62, 0x67, 0x45, 0x16, 0xaf, 0x2e, 0x44, 0x1b, 0x92, 0x7a, 0x2e, 0x97, 0xd1, 0xc1,
+  0x9f, 0x1d, 0x5c, 0x20, 0x8d, 0xf9, 0xb3, 0x70, 0xb9, 0x3e, 0x1a, 0x2a, 0xd5, 0x03, 0x51, 0xfd,
+  0x1b, 0x64, 0xdf, 0x8d, 0xfa, 0x63, 0x51, 0x9f, 0x50, 0x6d, 0x37, 0x1a, 0x9b, 0xf5, 0x2c, 0x24,
+  0xcc, 0xab, 0x4b, 0xc7, 0x42, 0x40, 0x79, 0x8d, 0x0f, 0x32, 0xb3, 0x6f, 0x57, 0xc9, 0x15, 0xbb,
+  0x04, 0xc3, 0xe8, 0xbe, 0x7f, 0xc1, 0xaf, 0x52, 0xf0, 0xa7, 0x20, 0xcb, 0x34, 0xa3, 0x5b, 0x2e,
+  0x58, 0x0f, 0xd0, 0x93, 0x26, 0xc1, 0xd7, 0x07, 0xaa, 0x59, 0x92, 0xc5, 0x9c, 0xdc, 0xc0, 0x35,
+  0x31, 0xed, 0xb0, 0xf2, 0x49, 0x18, 0xa3, 0xf1, 0xbb, 0x3d, 0x9a, 0xbc, 0x02, 0x05, 0x08, 0x02,
+  0x27, 0x2d, 0x89, 0x56, 0x17, 0x98, 0xf6, 0x94, 0x19, 0xec, 0x4b, 0x64, 0xbf, 0x74, 0x31, 0x6a,
+  0xc8, 0x60, 0xc1, 0x74, 0x05, 0xb9, 0x92, 0x55, 0x3c, 0x67, 0xa3, 0x66, 0xff, 0x63, 0x78, 0x93,
+  0x3d, 0xc9, 0xd7, 0xa3, 0x07, 0x1d, 0x1e, 0xe8, 0x58, 0xd0, 0x24, 0x6f, 0x14, 0x35, 0xbe, 0x2e,
+  0x59, 0x7f, 0x9a, 0x31, 0x09, 0xd7, 0x79, 0x74, 0xc8, 0xca, 0xdf, 0x8e, 0x14, 0xc5, 0xa9, 0xd5,
+  0xa6, 0xc8, 0x4a, 0x28, 0xbb, 0xbf, 0xdf, 0x39, 0x9b, 0xcd, 0x3a, 0xbf, 0x75, 0xda, 0xfe, 0xa0,
+  0x5b, 0xf7, 0x04, 0x8b, 0x53, 0x2e, 0xac, 0xe3, 0x03, 0xfc, 0x46, 0xa5, 0xca, 0x4f, 0x54, 0x35,
+  0xfc, 0xdc, 0x7e, 0x54, 0xd0, 0x7b, 0x07, 0xda, 0x8d, 0x95, 0xb5, 0xe5, 0x7b, 0x52, 0x59, 0xac,
+  0x9e, 0xd3, 0x95, 0x65, 0xe5, 0xc1, 0x99, 0xac, 0x7a, 0x9d, 0x85, 0xf3, 0x79, 0x3c, 0x65, 0x3f,
+  0xfd, 0xfe, 0x1f, 0xd1, 0xf4, 0xd3, 0xef, 0xff, 0x5e, 0xb4, 0x1c, 0x14, 0x59, 0x8d, 0x98, 0x64,
+  0x74, 0x99, 0x4a, 0x8f, 0xe4, 0xfd, 0xa3, 0x6c, 0xaf, 0x99, 0x50, 0xf7, 0x60, 0x90, 0xfa, 0xe9,
+  0xde, 0xa8, 0xc1, 0xdd, 0xc6, 0xf0, 0xd9, 0x69, 0x65, 0xf2, 0xc0, 0x64, 0x76, 0x6d, 0xaf, 0xeb,
+  0x9d, 0xe5, 0x8d, 0xc3, 0xc5, 0x18, 0xf1, 0x9e, 0xb5, 0x3e, 0xf3, 0xc7, 0x48, 0x36, 0xaa, 0x9b,
+  0x05, 0x9b, 0xa9, 0x76, 0xaf, 0x27, 0xc0, 0x90, 0x0b, 0xa2, 0x05, 0xb2, 0xe7, 0xd8, 0xad, 0x37,
+  0x8d, 0xb7, 0x18, 0xbb, 0xa0, 0x7b, 0x6a, 0x84, 0xfd, 0x01, 0x53, 0x7c, 0x21, 0x04, 0x1e, 0xf5,
+  0x83, 0x42, 0x21, 0x2f, 0xe4, 0x8f, 0xb0, 0xa4, 0x8f, 0xd0, 0x8a, 0x54, 0x5c, 0x9c, 0xd5, 0xf8,
+  0x29, 0xc0, 0x9e, 0x02, 0xbc, 0xab, 0x2f, 0xdf, 0x11, 0x50, 0xba, 0xee, 0x9e, 0xb0, 0xa1, 0x61,
+  0xf5, 0xfa, 0x49, 0xed, 0x40, 0xf6, 0x5a, 0xf7, 0x21, 0x97, 0xd1, 0xcf, 0xeb, 0x6e, 0x2f, 0x92,
+  0x90, 0xe7, 0xce, 0xe3, 0xf7, 0xfb, 0xf4, 0xa2, 0x8f, 0xca, 0xb5, 0xdf, 0xdb, 0xe5, 0xb5, 0xc4,
+  0x00, 0xa2, 0x40, 0x1e, 0x1d, 0x36, 0x16, 0x37, 0x12, 0x8c, 0xb6, 0x12, 0x6d, 0x47, 0xbd, 0x81,
+  0x89, 0x63, 0xb6, 0x61, 0xbd, 0xb4, 0x2c, 0x21, 0xbd, 0x8d, 0xa2, 0xf5, 0x23, 0x3a, 0xdd, 0xa3,
+  0xf6, 0x5b, 0xc1, 0xa3, 0x73, 0xae, 0x6b, 0x01, 0xb6, 0x52, 0xcf, 0x3e, 0x40, 0xcb, 0xdc, 0x7b,
+  0x27, 0x50, 0xde, 0xa1, 0x3f, 0x44, 0x71, 0xd6, 0xd3, 0x01, 0x90, 0x8e, 0x5e, 0xc5, 0xbe, 0xcd,
+  0x75, 0x81, 0x4b, 0xc6, 0xac, 0xed, 0x7d, 0x9b, 0x5c, 0x46, 0x95, 0x4f, 0xdf, 0xb7, 0xe1, 0x0f,
+  0x21, 0x5b, 0xdb, 0x02, 0xbb, 0xf3, 0xfd, 0xf2, 0xe1, 0xfd, 0x56, 0x6a, 0x4e, 0x60, 0xb4, 0x7a,
+  0x47, 0xab, 0xc1, 0x9e, 0xeb, 0x17, 0x98, 0xad, 0xc7, 0xd4, 0x5b, 0x90, 0x55, 0x23, 0xe3, 0xb3,
+  0xb4, 0x47, 0xf4, 0x5b, 0xe5, 0x6f, 0xf9, 0x94, 0x1d, 0x24, 0xb4, 0xbb, 0xf5, 0x5e, 0x91, 0xca,
+  0x37, 0xc9, 0xdd, 0x60, 0xa9, 0x43, 0xdb, 0x35, 0xd5, 0x0d, 0xc2, 0x3d, 0xf5, 0xdb, 0xac, 0x90,
+  0x2f, 0x7e, 0xbb, 0xa7, 0x41, 0x6b, 0xe7, 0x2c, 0x54, 0x5f, 0xfb, 0xc0, 0x76, 0x0b, 0x7f, 0x9f,
+  0xdc, 0x6b, 0xf6, 0xea, 0xab, 0x07, 0xdd, 0xd3, 0x77, 0x06, 0x11, 0x19, 0x3a, 0x9a, 0x14, 0x2b,
+  0xf1, 0x64, 0xd8, 0x6b, 0x66, 0x7a, 0x6f, 0x78, 0xb3, 0x6a, 0x50, 0x2f, 0x8e, 0x85, 0xe2, 0xa5,
+  0x1b, 0xdb, 0x5d, 0xdd, 0x23, 0xe4, 0xa3, 0xc9, 0xc7, 0x94, 0x69, 0xed, 0xd5, 0xa1, 0xaf, 0xbb,
+  0x33, 0x92, 0xef, 0x17, 0xed, 0xfe, 0x3d, 0x89, 0xa8, 0xdf, 0x0e, 0xf6, 0x24, 0x85, 0x06, 0x4c,
+  0xc4, 0x23, 0x48, 0x81, 0xd7, 0xc3, 0x9e, 0x14, 0xd1, 0x40, 0xe1, 0x56, 0x78, 0x14, 0x52, 0x5a,
+  0xe4, 0x5b, 0xc9, 0xe7, 0xab, 0x57, 0x79, 0x16, 0x2e, 0xd9, 0x97, 0x0d, 0x60, 0x43, 0xf1, 0x62,
+  0xf2, 0x3a, 0xf2, 0xd7, 0x34, 0xec, 0x69, 0xc5, 0x62, 0xce, 0x6c, 0x9e, 0x9d, 0x0e, 0xfb, 0xd9,
+  0xa1, 0x7c, 0xcd, 0xbd, 0x83, 0x01, 0x2f, 0xe3, 0x69, 0x96, 0xca, 0xe9, 0x64, 0xcf, 0x3a, 0xfe,
+  0xae, 0x83, 0xe0, 0x7a, 0xb9, 0x76, 0x8f, 0x16, 0x11, 0x99, 0x06, 0xf7, 0x42, 0x50, 0x3e, 0x55,
+  0xee, 0xd6, 0x70, 0xd9, 0xa8, 0xc9, 0x4f, 0xbb, 0xb4, 0xd9, 0xb7, 0x4a, 0x2f, 0xf7, 0x95, 0xcc,
+  0x40, 0xc5, 0xa7, 0x3d, 0xf2, 0xcf, 0xf9, 0x1f, 0x5a, 0xd9, 0x63, 0x87, 0xcd, 0xed, 0xd8, 0x46,
+  0x57, 0xb2, 0xb4, 0x4a, 0x7a, 0xcd, 0xda, 0x2f, 0x9b, 0x4a, 0xda, 0x35, 0x13, 0x1d, 0x09, 0x7c,
+  0x27, 0x9e, 0x74, 0x5f, 0x55, 0xd3, 0x71, 0x65, 0xbd, 0x85, 0xb8, 0x94, 0x77, 0xca, 0x5b, 0x1c,
+  0xe9, 0x76, 0xc7, 0x2d, 0x9e, 0x34, 0xf0, 0x7b, 0x19, 0x16, 0x0b, 0x8d, 0x7f, 0xe9, 0x5a, 0x8c,
+  0xad, 0xdf, 0xf0, 0x6a, 0xd3, 0xf5, 0xe6, 0xfb, 0x9c, 0xa3, 0x69, 0xda, 0xf4, 0x39, 0x81, 0x4e,
+  0x4f, 0xcf, 0xf1, 0x3f, 0xf8, 0xfa, 0x31, 0xa7, 0x60, 0x3c, 0xdc, 0x6b, 0x69, 0x81, 0x64, 0x49,
+  0x1b, 0xf4, 0x32, 0x9d, 0x45, 0xb7, 0xb0, 0xd2, 0xea, 0x15, 0x7e, 0x0f, 0x1d, 0xad, 0xb7, 0x0f,
+  0xb5, 0xa2, 0x98, 0x9f, 0xff, 0x65, 0x98, 0x2d, 0xb5, 0xb5, 0xa3, 0xf7, 0x57, 0xd3, 0x16, 0x80,
+  0x09, 0x96, 0x48, 0x1c, 0x40, 0xbf, 0x6d, 0x67, 0xfe, 0x0a, 0x78, 0x07, 0x9a, 0xe2, 0x49, 0xb1,
+  0x98, 0x45, 0x74, 0xec, 0x07, 0x54, 0x3c, 0xea, 0xed, 0x56, 0xff, 0x78, 0x7d, 0xd4, 0x37, 0x4d,
+  0xd8, 0x15, 0x65, 0x47, 0x5d, 0x99, 0xc2, 0xc3, 0xae, 0xf0, 0x21, 0x98, 0xc8, 0xfe, 0xf4, 0xc7,
+  0x3f, 0xfc, 0xd7, 0x86, 0xe0, 0xb6, 0xd7, 0xf2, 0x7c, 0xb4, 0x5c, 0xd0, 0xb7, 0x4e, 0x5b, 0xce,
+  0x0a, 0x5a, 0xbc, 0xab, 0x9f, 0xa4, 0xa1, 0x7c, 0x87, 0xb6, 0xe0, 0xca, 0x37, 0xaf, 0xf4, 0x05,
+  0x6f, 0x65, 0x4c, 0xe7, 0x59, 0x5b, 0x0b, 0xe7, 0x46, 0xa8, 0xde, 0x3a, 0x79, 0x13, 0xaa, 0x5b,
+  0xd5, 0xa8, 0x7d, 0x69, 0xd1, 0xbe, 0xeb, 0xd8, 0x6f, 0xaf, 0x75, 0x32, 0x23, 0xc8, 0xec, 0xf8,
+  0x28, 0x4f, 0xe3, 0xd8, 0xe5, 0xd6, 0x3b, 0x9c, 0x82, 0x65, 0x12, 0x7a, 0xbf, 0x3d, 0xce, 0x9d,
+  0x9f, 0x07, 0xaa, 0x30, 0xbe, 0xe6, 0x28, 0xf3, 0xb3, 0x5d, 0x6d, 0x47, 0xcd, 0x2d, 0x14, 0xd1,
+  0xf6, 0xe4, 0xfa, 0x9d, 0x94, 0x2d, 0x58, 0xca, 0x7e, 0x4a, 0x05, 0x60, 0x6b, 0x5b, 0x65, 0x27,
+  0x76, 0xd7, 0xef, 0xae, 0xf4, 0x11, 0xd4, 0x8d, 0x42, 0xfa, 0x78, 0x4d, 0x56, 0x7f, 0x03, 0x47,
+  0xc1, 0x95, 0x24, 0xce, 0x8b, 0xde, 0x2c, 0xa1, 0x57, 0xe1, 0x35, 0x3f, 0x88, 0x82, 0xcf, 0x3a,
+  0x94, 0xf9, 0x77, 0xbf, 0xeb, 0x50, 0xf1, 0x72, 0x0b, 0xe9, 0xe4, 0xe4, 0x84, 0xe9, 0x2a, 0x7d,
+  0x12, 0x81, 0xc6, 0xb2, 0x73, 0xb8, 0xfd, 0x2a, 0xcd, 0xf7, 0xfd, 0xa3, 0xc1, 0xe9, 0x37, 0x69,
+  0xe3, 0xd9, 0x00, 0xbd, 0x0d, 0xc8, 0xb2, 0xf0, 0x8a, 0x1e, 0x7d, 0x29, 0x06, 0x5c, 0x6e, 0x50,
+  0x95, 0xfc, 0xe9, 0xda, 0xa8, 0x12, 0x5f, 0xf7, 0x07, 0x42, 0x1f, 0xaa, 0x3f, 0x95, 0xe0, 0x77,
+  0xfd, 0x31, 0x80, 0x8f, 0xac, 0x98, 0xb5, 0xfb, 0x7c, 0xac, 0xfe, 0x3a, 0x40, 0xd7, 0xbe, 0xd2,
+  0xff, 0x03, 0x3b, 0x60, 0x3b, 0x36, 0xbc, 0x4a, 0x78, 0x83, 0x53, 0xf1, 0x41, 0x8a, 0x62, 0xb1,
+  0x63, 0x63, 0x8c, 0x44, 0x57, 0x6e, 0x84, 0xdd, 0xb4, 0x75, 0xd6, 0xdd, 0x2e, 0x7c, 0xc0, 0x75,
+  0x53, 0x88, 0x57, 0xe4, 0x7c, 0x07, 0xe1, 0xc6, 0x6e, 0x84, 0xcf, 0x35, 0x9d, 0xca, 0x37, 0xdc,
+  0x37, 0x01, 0x93, 0xfd, 0x6e, 0x80, 0x36, 0xa9, 0xbe, 0x3c, 0x24, 0xfa, 0xdf, 0x0c, 0x90, 0xfa,
+  0xf2, 0x51, 0xd7, 0x74, 0xed, 0xde, 0x03, 0xec, 0xee, 0x4b, 0xfb, 0x13, 0xbb, 0x9a, 0xe5, 0x96,
+  0xce, 0x83, 0x5d, 0xa1, 0xa4, 0xda, 0x41, 0x24, 0x3b, 0x69, 0xae, 0xba, 0x85, 0xc1, 0x8b, 0xf5,
+  0x3c, 0xff, 0x62, 0xa0, 0x74, 0x5c, 0xe5, 0x5f, 0x0b, 0x23, 0xd3, 0x1c, 0x3e, 0xfd, 0xee, 0xab,
+  0xaf, 0x86, 0xe4, 0xb6, 0x3e, 0xb7, 0x27, 0x8f, 0x9e, 0x3a, 0x3a, 0x77, 0x5c, 0x9f, 0x9b, 0x46,
+  0xe0, 0x3e, 0xb5, 0xba, 0x37, 0xb5, 0xee, 0x65, 0x1f, 0x52, 0xe0, 0x01, 0xad, 0xbc, 0x71, 0x07,
+  0xed, 0xf3, 0xaa, 0x3b, 0x20, 0xf7, 0xd9, 0x6e, 0xe3, 0x7d, 0xc5, 0xb1, 0xd6, 0x0d, 0xdd, 0x5b,
+  0x3e, 0x87, 0x06, 0xab, 0xdc, 0xc2, 0xe8, 0x1d, 0xc6, 0x56, 0x11, 0x20, 0x18, 0xf9, 0x50, 0x78,
+  0x76, 0x79, 0x51, 0x80, 0x32, 0x36, 0x91, 0x4c, 0xd3, 0x53, 0xb6, 0x32, 0x35, 0xee, 0x8b, 0xcb,
+  0xf6, 0x1f, 0x77, 0x11, 0xf3, 0x89, 0x19, 0x94, 0x2b, 0x0c, 0x34, 0xc5, 0x4f, 0xff, 0xfa, 0x8f,
+  0x1c, 0xfc, 0x4f, 0xff, 0xfa, 0xdf, 0xef, 0x75, 0x86, 0x49, 0xf5, 0x92, 0xeb, 0xe7, 0x99, 0x44,
+  0xbd, 0x51, 0xf1, 0xb3, 0x4e, 0xf1, 0xf3, 0x11, 0x22, 0x32, 0xe2, 0xa7, 0x71, 0x92, 0x28, 0x7c,
+  0x7b, 0x2d, 0xd7, 0x95, 0xf7, 0x0e, 0x5d, 0x50, 0xf3, 0x5a, 0x2c, 0x3c, 0xef, 0x02, 0xbd, 0xfc,
+  0x4e, 0x52, 0xa5, 0xc2, 0xd5, 0x52, 0x78, 0xba, 0xd8, 0xac, 0xde, 0xaa, 0x9b, 0x39, 0xb2, 0x59,
+  0xac, 0x75, 0x95, 0x56, 0xf1, 0x2b, 0xc7, 0x73, 0xeb, 0x8f, 0x40, 0xa9, 0x0b, 0xfc, 0x26, 0xf8,
+  0x6b, 0x77, 0xba, 0x1b, 0x53, 0xf5, 0xd9, 0xe8, 0xbe, 0x99, 0x83, 0xca, 0xba, 0x50, 0x3a, 0x8f,
+  0x84, 0xbe, 0x29, 0x57, 0x2d, 0x59, 0x59, 0x3e, 0xbc, 0xe5, 0x5e, 0xfa, 0x8d, 0x9b, 0xe9, 0x5d,
+  0x99, 0xcd, 0xee, 0x0d, 0x75, 0x45, 0xc4, 0xbf, 0xd9, 0x44, 0x1b, 0x2c, 0x45, 0xd5, 0x83, 0x43,
+  0xce, 0x17, 0xfe, 0xe5, 0x3c, 0x7a, 0x15, 0x4c, 0x79, 0xcf, 0xf6, 0xd7, 0xa9, 0xf6, 0x59, 0x98,
+  0xd3, 0xa7, 0xe4, 0xc4, 0x57, 0xf4, 0xe8, 0x2f, 0xef, 0xa6, 0x73, 0xfe, 0xa6, 0x9e, 0x1e, 0xf1,
+  0xb7, 0x73, 0xb6, 0x7a, 0x3d, 0x51, 0x1e, 0xe8, 0x31, 0x31, 0x2d, 0x67, 0xc6, 0xe3, 0xfa, 0x5c,
+  0x6a, 0xbb, 0x4d, 0x2c, 0x81, 0x15, 0x86, 0xca, 0x46, 0xbe, 0x01, 0xc0, 0x3f, 0x10, 0xd6, 0x04,
+  0x8f, 0x41, 0x5f, 0x94, 0x0b, 0xe3, 0x6e, 0xaa, 0x85, 0xd4, 0xa5, 0xa0, 0x3f, 0x28, 0xa8, 0x8a,
+  0x67, 0xcf, 0x32, 0x67, 0x94, 0xa8, 0x0c, 0x75, 0x05, 0x3d, 0x11, 0xd3, 0xde, 0xd2, 0x35, 0x07,
+  0xac, 0xea, 0x9b, 0xb5, 0x44, 0x36, 0x06, 0xb3, 0x1f, 0x87, 0x8f, 0xe9, 0xca, 0xda, 0xd7, 0xfc,
+  0xdf, 0x97, 0xfc, 0xdf, 0xbf, 0x78, 0x3c, 0x7c, 0xd3, 0xec, 0x1c, 0xa3, 0x23, 0x27, 0x69, 0x9e,
+  0xa4, 0x58, 0xc4, 0xf0, 0x5f, 0x93, 0xf4, 0xa2, 0x44, 0xea, 0x80, 0x55, 0x35, 0x6f, 0xf7, 0xf6,
+  0x5a, 0xcc, 0x51, 0x58, 0x21, 0x10, 0x96, 0xbd, 0xd7, 0xe9, 0xe5, 0xe8, 0xed, 0x3e, 0x8b, 0xf7,
+  0x04, 0x6b, 0xf6, 0x84, 0xbe, 0x71, 0x26, 0xf2, 0xd8, 0x42, 0xf8, 0xfd, 0x18, 0xbf, 0xb9, 0x8e,
+  0x33, 0x72, 0x21, 0xbf, 0x69, 0xf1, 0x05, 0x41, 0xe6, 0x58, 0xea, 0xae, 0xc4, 0x61, 0x23, 0x8c,
+  0xf1, 0xdf, 0xff, 0x67, 0xde, 0x58, 0x61, 0x54, 0x1d, 0xd5, 0xbe, 0x54, 0x2b, 0x55, 0x1f, 0x56,
+  0xf6, 0x34, 0x7e, 0x1f, 0xcd, 0x46, 0x86, 0xb0, 0x82, 0x65, 0xde, 0x96, 0x7c, 0xdd, 0xb9, 0xd1,
+  0xdf, 0x2c, 0xad, 0xe6, 0x3a, 0xec, 0xe5, 0x06, 0x81, 0xb8, 0x66, 0x9b, 0xb7, 0x97, 0x1e, 0xb3,
+  0xf0, 0x2a, 0x6f, 0x72, 0x5d, 0x76, 0xc4, 0x7c, 0xbe, 0x6b, 0xeb, 0xf5, 0x16, 0x85, 0xe8, 0xbf,
+  0x48, 0x37, 0x59, 0x6b, 0x40, 0x35, 0xe2, 0x0b, 0x39, 0x02, 0x43, 0x2d, 0x77, 0x6b, 0xe4, 0x32,
+  0x5e, 0xed, 0x1e, 0xc8, 0xfb, 0x63, 0x9c, 0xab, 0x37, 0x56, 0x36, 0x1c, 0xbb, 0x53, 0x45, 0xef,
+  0x78, 0x05, 0x68, 0x9e, 0x71, 0xe1, 0x09, 0x64, 0x50, 0x5c, 0x34, 0xf8, 0x2d, 0xaa, 0xd5, 0x61,
+  0x75, 0x47, 0x3e, 0x8e, 0xa3, 0x82, 0xd2, 0xb2, 0xcd, 0xe7, 0x76, 0x43, 0xf7, 0x12, 0xb9, 0x7d,
+  0xff, 0xa8, 0xc5, 0x52, 0x79, 0x15, 0xf0, 0xba, 0xd5, 0xdc, 0xd6, 0x45, 0xc2, 0x96, 0xd1, 0x34,
+  0x26, 0xb8, 0x0e, 0x50, 0xb3, 0x67, 0xbd, 0x2c, 0x6c, 0xd6, 0x6f, 0x2d, 0x95, 0x4b, 0x14, 0xbf,
+  0x94, 0xeb, 0x61, 0x8a, 0xc0, 0x62, 0x89, 0x5c, 0xb9, 0x54, 0xf8, 0xbb, 0xef, 0xc5, 0xe6, 0x41,
+  0xf5, 0x70, 0x29, 0x2c, 0x8a, 0x2c, 0x3e, 0xa7, 0x1c, 0xee, 0x3c, 0xa4, 0xcf, 0x1c, 0xd0, 0xa7,
+  0xcc, 0x08, 0x8a, 0x7c, 0xb0, 0xd3, 0x49, 0xc2, 0x73, 0xba, 0xf1, 0x42, 0x24, 0xb4, 0x30, 0x82,
+  0xbb, 0xca, 0xae, 0xce, 0xa2, 0x04, 0x89, 0x40, 0x9a, 0x3d, 0x82, 0xbf, 0x1d, 0xf2, 0xbb, 0x31,
+  0xdb, 0x14, 0x08, 0x00, 0x55, 0x46, 0x2d, 0x6e, 0xd0, 0x34, 0x52, 0x6a, 0x61, 0x62, 0x9c, 0xa0,
+  0xe6, 0xe6, 0x0a, 0xef, 0xab, 0x89, 0x0f, 0x94, 0x3c, 0x2a, 0x71, 0x1f, 0x0d, 0x4b, 0x7a, 0xd4,
+  0xad, 0xd1, 0x8f, 0x2c, 0x4a, 0xf2, 0xa8, 0x63, 0x34, 0x68, 0xeb, 0x1a, 0x0a, 0xf7, 0xd5, 0x09,
+  0xa6, 0x75, 0xcc, 0x2b, 0xf5, 0x87, 0x36, 0xa8, 0xca, 0xbf, 0xb2, 0x9e, 0xf2, 0x47, 0xf4, 0x32,
+  0x49, 0x15, 0x4f, 0x01, 0x1d, 0x26, 0x0d, 0x41, 0x5c, 0xf3, 0x56, 0x2e, 0x70, 0x0b, 0x28, 0xcd,
+  0xc3, 0x41, 0x51, 0x07, 0xbc, 0xca, 0x03, 0xcf, 0x91, 0xda, 0xbe, 0x4f, 0x37, 0xbe, 0x84, 0x11,
+  0x61, 0x7d, 0x2c, 0xaf, 0xa2, 0x1f, 0x1f, 0x88, 0xbf, 0x9b, 0x77, 0x7c, 0x40, 0xa1, 0xef, 0xf4,
+  0xc1, 0xff, 0x05, 0xa2, 0x78, 0x1b, 0xe4, 0x26, 0x7f, 0x00, 0x00,
+};
+
+// web/saved.html: 2579 bytes, 1150 gzipped
+#define SAVED_HTML_ETAG "\"7032f6dea7a36e60\""
+static const size_t SAVED_HTML_GZ_LEN = 1150;
+static const uint8_t SAVED_HTML_GZ[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xbd, 0x56, 0xcd, 0x6e, 0xdb, 0x46,
+  0x10, 0xbe, 0xe7, 0x29, 0x26, 0x32, 0x02, 0x49, 0x05, 0x49, 0x51, 0x92, 0x2d, 0x1b, 0xfa, 0x03,
+  0xe2, 0xd4, 0x01, 0x72, 0x68, 0x63, 0x58, 0xce, 0xc1, 0xc7, 0x15, 0x39, 0x24, 0xb7, 0x26, 0x77,
+  0xd9, 0xdd, 0xa5, 0x64, 0x35, 0xf0, 0xad, 0xed, 0xb9, 0x87, 0x1e, 0x0b, 0xf4, 0xdd, 0xf2, 0x04,
+  0x7d, 0x84, 0xce, 0x2e, 0x29, 0x5a, 0xb1, 0xdd, 0x06, 0x08, 0xd0, 0xda, 0x86, 0xbc, 0x3f, 0xb3,
+  0xdf, 0x7c, 0x33, 0xdf, 0xcc, 0xd8, 0xf3, 0x97, 0xdf, 0xbe, 0x7f, 0x73, 0x7d, 0x73, 0x79, 0x01,
+  0x99, 0x29, 0xf2, 0xe5, 0x8b, 0xf9, 0xfe, 0x17, 0xb2, 0x78, 0xf9, 0x02, 0x60, 0x5e, 0xa0, 0x61,
+  0x10, 0x65, 0x4c, 0x69, 0x34, 0x8b, 0xce, 0x87, 0xeb, 0xb7, 0xfe, 0x59, 0xe7, 0xe1, 0x42, 0xb0,
+  0x02, 0x17, 0x9d, 0x0d, 0xc7, 0x6d, 0x29, 0x95, 0xe9, 0x40, 0x24, 0x85, 0x41, 0x41, 0x86, 0x5b,
+  0x1e, 0x9b, 0x6c, 0x11, 0xe3, 0x86, 0x47, 0xe8, 0xbb, 0x8d, 0x07, 0x5c, 0x70, 0xc3, 0x59, 0xee,
+  0xeb, 0x88, 0xe5, 0xb8, 0x18, 0x06, 0x61, 0x0d, 0x64, 0xb8, 0xc9, 0x71, 0xf9, 0x46, 0x8a, 0x84,
+  0xa7, 0x95, 0x62, 0x86, 0x4b, 0x01, 0x2b, 0xb6, 0xc1, 0x78, 0x3e, 0xa8, 0xaf, 0xac, 0x91, 0x36,
+  0xbb, 0x7a, 0x05, 0xf0, 0x0d, 0x7c, 0x84, 0x82, 0xa9, 0x94, 0x8b, 0x29, 0x84, 0x33, 0x28, 0x59,
+  0x1c, 0x73, 0x91, 0xba, 0xf5, 0x5a, 0xde, 0xf9, 0x9a, 0xff, 0xe4, 0xb6, 0x6b, 0xa9, 0x62, 0x54,
+  0x3e, 0x1d, 0xcd, 0xe0, 0xde, 0x3d, 0x5c, 0xcb, 0x78, 0x47, 0x6f, 0x13, 0xe2, 0xe8, 0x27, 0xac,
+  0xe0, 0xf9, 0x6e, 0x0a, 0x3e, 0x2b, 0xcb, 0x1c, 0x7d, 0xbd, 0xd3, 0x06, 0x0b, 0x0f, 0xce, 0x73,
+  0x2e, 0x6e, 0xbf, 0x63, 0xd1, 0xca, 0xed, 0xdf, 0x92, 0xa5, 0x07, 0xdd, 0x15, 0xa6, 0x12, 0xe1,
+  0xc3, 0xbb, 0xae, 0x07, 0x57, 0x72, 0x2d, 0x8d, 0xf4, 0xe0, 0xb5, 0xa2, 0x40, 0x3c, 0xd0, 0x4c,
+  0x68, 0x5f, 0xa3, 0xe2, 0x09, 0xf9, 0x66, 0xd1, 0x6d, 0xaa, 0x64, 0x25, 0xe2, 0x29, 0x10, 0x0a,
+  0x32, 0xe5, 0xa7, 0x8a, 0xc5, 0x9c, 0xd2, 0xd1, 0x1b, 0x8e, 0x4f, 0x62, 0x4c, 0x3d, 0x38, 0x9a,
+  0x4c, 0x4e, 0x11, 0x19, 0x84, 0xaf, 0x68, 0x7d, 0x3a, 0x39, 0x5e, 0xb3, 0x11, 0x0c, 0xc3, 0xf0,
+  0x55, 0x7f, 0x06, 0x05, 0x17, 0x7e, 0x86, 0x3c, 0xcd, 0xcc, 0xd4, 0x1e, 0x6d, 0xb2, 0x83, 0xc8,
+  0x46, 0x61, 0x49, 0x41, 0xc4, 0x5c, 0x97, 0x39, 0x23, 0xce, 0x49, 0x8e, 0xb4, 0x65, 0x39, 0x4f,
+  0x85, 0xcf, 0x89, 0xa6, 0x9e, 0x42, 0x44, 0x5e, 0x50, 0xcd, 0xe0, 0x87, 0x4a, 0x1b, 0x9e, 0xec,
+  0xfc, 0x46, 0x87, 0xf6, 0xc2, 0xc5, 0x5f, 0x67, 0x21, 0xb0, 0x77, 0x8c, 0x08, 0x2a, 0xca, 0xc5,
+  0x21, 0xe9, 0x6d, 0x46, 0x60, 0xb3, 0x7d, 0xde, 0x2c, 0xf5, 0x8a, 0x90, 0x87, 0x23, 0xeb, 0xdb,
+  0x25, 0x36, 0x63, 0xb1, 0xdc, 0x52, 0x9e, 0x1d, 0x1f, 0x98, 0xd8, 0x0f, 0x95, 0xae, 0x59, 0x2f,
+  0xf4, 0xdc, 0x77, 0x30, 0xb6, 0x61, 0xb0, 0xbb, 0x5a, 0xee, 0x29, 0x9c, 0x84, 0x8e, 0x76, 0x1b,
+  0xc5, 0xb1, 0xdb, 0x1a, 0xbc, 0x33, 0xbe, 0xe3, 0xbe, 0x27, 0x77, 0xc8, 0x6d, 0x6d, 0x04, 0xb1,
+  0x6a, 0x9f, 0x0c, 0x4f, 0xc8, 0x47, 0xfd, 0xae, 0xa6, 0x35, 0x05, 0x21, 0xc5, 0x53, 0x92, 0x13,
+  0x6b, 0xe1, 0x74, 0x25, 0xf5, 0x91, 0xde, 0x3d, 0x1c, 0x6c, 0x9b, 0x9c, 0x12, 0x9b, 0x19, 0x44,
+  0x95, 0xd2, 0x92, 0x40, 0x4a, 0xc9, 0xeb, 0x7c, 0x19, 0x45, 0x0a, 0x72, 0x5b, 0x72, 0x53, 0x4a,
+  0x68, 0x0e, 0x61, 0x30, 0xd2, 0xb3, 0xb6, 0xba, 0x86, 0x0f, 0x8c, 0x63, 0x8c, 0x64, 0x5d, 0x9b,
+  0x7b, 0x0a, 0xad, 0x1c, 0x5c, 0x58, 0xb9, 0xfd, 0x75, 0x2e, 0xa3, 0xdb, 0xd9, 0xa3, 0x60, 0xfc,
+  0x52, 0x71, 0x42, 0xdb, 0x3d, 0x4a, 0xf5, 0x57, 0xd4, 0x47, 0x24, 0x73, 0xcb, 0xbc, 0x16, 0xe9,
+  0x1f, 0xbc, 0x4c, 0x33, 0xb9, 0x71, 0xb2, 0xba, 0xb0, 0x12, 0xa9, 0x8a, 0x69, 0xbd, 0xcc, 0x99,
+  0xc1, 0x9b, 0x9e, 0x4f, 0x52, 0xf6, 0x1f, 0x6b, 0x69, 0x33, 0xec, 0xd2, 0xec, 0xa4, 0x1c, 0x86,
+  0x23, 0x8f, 0x24, 0x9f, 0x78, 0x30, 0x1a, 0x1f, 0x7b, 0x94, 0x8e, 0xe3, 0xfe, 0x13, 0x67, 0x9a,
+  0x52, 0x21, 0xe2, 0xa7, 0x41, 0x1d, 0x4d, 0xa2, 0xd3, 0x93, 0xd3, 0xf8, 0x0b, 0x54, 0xdb, 0xd7,
+  0x2d, 0xd9, 0xcf, 0x30, 0x4e, 0xd8, 0x64, 0x34, 0x39, 0x3b, 0x7c, 0x95, 0x0d, 0xc9, 0xa6, 0x81,
+  0x3c, 0x1a, 0x9d, 0xb1, 0xd3, 0xe3, 0x93, 0xbd, 0x42, 0xd4, 0xdc, 0xc6, 0xc8, 0xa2, 0x6e, 0x90,
+  0xc6, 0xbc, 0x3c, 0xb0, 0x1e, 0x8f, 0xc7, 0x4f, 0x4c, 0xc7, 0x4e, 0x53, 0xa7, 0x58, 0xdb, 0x6e,
+  0xc1, 0xa4, 0x79, 0x7c, 0xa4, 0x0d, 0x33, 0x95, 0x6e, 0x07, 0x8c, 0x6f, 0x64, 0xb9, 0x6f, 0xbf,
+  0x3d, 0x68, 0x2d, 0xd1, 0xd3, 0xea, 0x72, 0x10, 0xf3, 0x41, 0x33, 0xa8, 0xe6, 0x83, 0x7a, 0x82,
+  0xce, 0xed, 0xd0, 0x71, 0x13, 0x2c, 0xe6, 0x1b, 0x88, 0x72, 0xa6, 0xf5, 0xa2, 0xd3, 0x76, 0x60,
+  0xa7, 0x9e, 0x68, 0xf3, 0x6c, 0xb8, 0xfc, 0xf4, 0xc7, 0x2f, 0xf0, 0xcc, 0x0c, 0x7c, 0x49, 0x40,
+  0xc3, 0xc6, 0xaa, 0x5c, 0xde, 0xc8, 0x4a, 0x01, 0x0d, 0x62, 0x43, 0xdd, 0xa1, 0x21, 0x23, 0x03,
+  0x58, 0x23, 0x0a, 0x9a, 0x43, 0x64, 0x0a, 0xba, 0x8a, 0x22, 0xd4, 0x3a, 0xa9, 0xf2, 0x7c, 0x07,
+  0x46, 0xda, 0x3a, 0xf5, 0x37, 0x92, 0xb4, 0xe7, 0x39, 0x42, 0x81, 0x85, 0x54, 0xbb, 0x60, 0x3e,
+  0x28, 0x5b, 0x34, 0x1a, 0xaa, 0x4a, 0x8a, 0x74, 0xf9, 0x1a, 0x14, 0x52, 0xe0, 0xca, 0x00, 0xd7,
+  0xb4, 0xfc, 0xb1, 0xe2, 0x8a, 0xd0, 0xa8, 0x7c, 0xec, 0xdc, 0x17, 0x29, 0x6a, 0x0b, 0x66, 0xd8,
+  0x2d, 0x02, 0x26, 0x09, 0x46, 0x26, 0xb0, 0x51, 0xba, 0x97, 0x0f, 0x68, 0xeb, 0x8a, 0xd2, 0x2b,
+  0xf6, 0x01, 0xda, 0x36, 0x3e, 0xa8, 0xcb, 0x0e, 0x48, 0x11, 0xe5, 0x3c, 0xba, 0x5d, 0x74, 0x1a,
+  0x4f, 0x17, 0xab, 0xcb, 0x5e, 0xbf, 0xb3, 0xfc, 0xeb, 0xcf, 0xdf, 0x7f, 0x86, 0xab, 0xc6, 0x39,
+  0x9d, 0x8d, 0x47, 0xf0, 0xbd, 0xdc, 0xce, 0x07, 0x35, 0xda, 0xbf, 0x42, 0xb7, 0x75, 0x74, 0x00,
+  0x9e, 0xca, 0x73, 0xaa, 0x25, 0x0b, 0xfc, 0xe9, 0xd7, 0xdf, 0xc0, 0xae, 0x2d, 0xf3, 0x55, 0x93,
+  0xaf, 0x47, 0xb0, 0x56, 0x0f, 0x1e, 0x2f, 0x3a, 0xb5, 0xe4, 0x1d, 0x8a, 0x85, 0x4e, 0x9c, 0x52,
+  0xed, 0x42, 0x47, 0x8a, 0x97, 0xa6, 0xb6, 0x4f, 0x2a, 0x11, 0x39, 0x59, 0x0e, 0x23, 0x80, 0x8f,
+  0xee, 0x0e, 0x20, 0x96, 0x51, 0x55, 0x50, 0x27, 0x07, 0x29, 0x9a, 0x8b, 0x1c, 0xed, 0xf2, 0x7c,
+  0xf7, 0x2e, 0xee, 0x75, 0x6b, 0xf4, 0x6e, 0x3f, 0xb0, 0x53, 0xe4, 0x4d, 0x3d, 0x95, 0x61, 0x01,
+  0xdd, 0x26, 0x68, 0xe2, 0x55, 0xc7, 0x1d, 0x04, 0x01, 0x5c, 0xe6, 0xc8, 0x34, 0xc2, 0x96, 0x71,
+  0x43, 0x5d, 0x0f, 0x75, 0x84, 0x3a, 0xe8, 0xce, 0x1a, 0x27, 0x09, 0x9a, 0x28, 0xeb, 0x75, 0x07,
+  0x0d, 0x03, 0xfa, 0x73, 0x44, 0x75, 0x8a, 0x26, 0x93, 0xd4, 0x38, 0xdd, 0xcb, 0xf7, 0xab, 0xeb,
+  0x2e, 0xdc, 0xf7, 0x1b, 0x5b, 0xea, 0x36, 0x93, 0xa1, 0xe8, 0x11, 0xc7, 0xc5, 0xb2, 0xa5, 0xf9,
+  0x55, 0x54, 0x6b, 0x5d, 0x5c, 0x69, 0xec, 0x39, 0x5b, 0xb6, 0x57, 0x18, 0x53, 0x9d, 0x44, 0x2e,
+  0x04, 0x2e, 0x9e, 0x25, 0x6c, 0xbf, 0xa8, 0x5a, 0xaf, 0x79, 0x81, 0xb2, 0x32, 0xcf, 0x70, 0x01,
+  0xd8, 0x72, 0x41, 0x83, 0x28, 0xa0, 0xd9, 0xe9, 0x8a, 0x3e, 0xc8, 0x14, 0x26, 0xd6, 0xe9, 0xe0,
+  0x33, 0x90, 0x7b, 0xcf, 0x8e, 0xc1, 0x30, 0xec, 0x3f, 0x1c, 0x1e, 0x46, 0x4a, 0x6f, 0x29, 0x31,
+  0xa8, 0xd4, 0x7f, 0x15, 0x6b, 0x8f, 0x4c, 0x04, 0xd6, 0xfa, 0xe7, 0x52, 0x1b, 0xf0, 0xc1, 0x64,
+  0x64, 0x45, 0x3f, 0x82, 0xa6, 0x2c, 0xcb, 0xfb, 0xff, 0x53, 0xcc, 0x87, 0x83, 0xb1, 0xad, 0xc8,
+  0x7d, 0xd9, 0xb7, 0x6e, 0xbe, 0xe4, 0xa0, 0x99, 0x54, 0x4d, 0x75, 0x53, 0x5f, 0xb8, 0x19, 0x45,
+  0x93, 0xc6, 0xfd, 0xef, 0xf7, 0x37, 0x17, 0xec, 0x14, 0x06, 0x13, 0x0a, 0x00, 0x00,
+};
+
+#endif // WEBASSETS_H
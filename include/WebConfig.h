@@ -6,6 +6,7 @@
 #include <ESPmDNS.h>
 #include <Preferences.h>
 #include "ESPProxy.h"
+#include "ChunkedWriter.h"
 
 class WebConfig {
 public:
@@ -13,7 +14,8 @@ public:
   ~WebConfig();
   
   bool begin();
-  void loop();  // Must be called regularly to handle HTTP requests
+  bool start();  // Run loop() in its own task (WEB_TASK_CORE)
+  void loop();   // Handle pending HTTP requests
   
   // Load configuration from NVRAM
   bool loadConfig(ProxyConfig& config);
@@ -32,22 +34,31 @@ private:
   WebServer* server;
   Preferences preferences;
   String currentMDNS;
+  ProxyStatus status;  // Latest copy from the proxy task (too big for the task stack)
+  
+  static void webTask(void* arg);
   
   // HTTP handlers
   void handleRoot();
+  void handleConfig();
   void handleStatus();
+  void handleMetrics();
   void handleSave();
   void handleRestart();
   void handleNotFound();
   
   // Helper functions
-  String generateHTML();
-  String generateStatusJSON();
+  void sendPage(const uint8_t* gz, size_t len, const char* etag);  // Gzipped page from WebAssets.h
+  void writeStatusJSON(ChunkedWriter& out);
+  void readStatus();  // Fill status from the proxy's snapshot
   
   // Configuration management
   void loadStringParameter(const char* key, char* value, size_t maxLen, const char* defaultValue);
   void loadUShortParameter(const char* key, uint16_t& value, uint16_t defaultValue);
   void loadBoolParameter(const char* key, bool& value, bool defaultValue);
+  void loadSocketProfile(const char* prefix, SocketProfile& profile, const SocketProfile& defaults);
+  void saveSocketProfile(const char* prefix, const SocketProfile& profile);
+  void readSocketProfile(const char* prefix, SocketProfile& profile, const SocketProfile& defaults);  // From the form
 };
 
 #endif // WEBCONFIG_H
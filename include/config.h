@@ -50,6 +50,11 @@
 // This identifies your device to the cloud server
 #define UNIQUE_ID "duotecno.esp32.net:5001"
 
+// More masters on the same LAN can be served by this proxy, each under its own
+// unique ID: add them in the web interface (Additional Masters). The master
+// and unique ID above are the first route.
+#define MAX_ROUTES 4
+
 // Enable debug logging (set to true for verbose output, including data forwarding details)
 #define DEBUG_MODE false
 
@@ -57,14 +62,128 @@
 // Advanced Configuration
 // ============================================
 
-// Maximum number of simultaneous connections
-// Increase if you need more simultaneous clients (uses more RAM)
-#define MAX_CONNECTIONS 10
+// Connection slots (free connections and clients together), allocated once at startup
+// Can be changed in the web interface (after a restart), each slot costs a few hundred
+// bytes of internal RAM plus its forwarding buffers (see FORWARD_BUFFER_SIZE)
+#define CONNECTION_CAPACITY 10
+
+// Most connection slots that can be configured (one bit per slot, at most 64)
+// Every client holds 2 sockets (cloud + master), a free connection 1: the lwIP of the
+// Arduino core has 16 (CONFIG_LWIP_MAX_SOCKETS), more clients need a firmware built with more
+#define MAX_CONNECTIONS 64
 
 // Connection check interval in milliseconds
 // How often to check if we need a new free connection
 #define CONNECTION_CHECK_INTERVAL 16000  // 16 seconds
 
+// When the last connection is gone (e.g. the cloud server was unreachable for a while),
+// the proxy rebuilds its free connections with the usual backoff instead of restarting.
+// Only when that fails for this long, the ESP32 is restarted (0 = never)
+#define OUTAGE_RESTART_TIMEOUT 600000    // 10 minutes
+
+// Warm pool: number of free (registered, idle) cloud connections kept ready for clients
+// The target grows with the measured client arrival rate, between these limits
+// (both can be changed in the web interface, they count per master)
+#define POOL_MIN_FREE 1
+#define POOL_MAX_FREE 4
+#define POOL_RATE_WINDOW 5000            // Arrival rate is measured over 5 second windows
+#define POOL_RATE_HORIZON 10             // Keep enough free connections for the clients expected in the next 10 seconds
+
+// Cloud connection setup (all non-blocking, driven from the proxy loop)
+#define CLOUD_DNS_TIMEOUT 5000           // Give up on a DNS lookup after 5 seconds
+#define CLOUD_CONNECT_TIMEOUT 5000       // Give up on connect + registration after 5 seconds
+#define CLOUD_BACKOFF_MIN 1000           // First retry after ~1 second
+#define CLOUD_BACKOFF_MAX 30000          // Never wait more than 30 seconds between retries
+#define CLOUD_DNS_POLL 10                // Check for the DNS answer every 10 ms while resolving
+#define DNS_CACHE_TTL 300000             // Use a resolved cloud address for 5 minutes without looking it up
+#define DNS_CACHE_REFRESH 240000         // Look it up again in the background after 4 minutes
+#define DNS_CACHE_RETRY 30000            // While lookups fail: keep the last good address, retry every 30 seconds
+
+// Device (master) connection setup
+#define DEVICE_CONNECT_TIMEOUT 3000      // Drop the client if the master doesn't answer within 3 seconds
+
+// Connections whose peer vanished without closing them (NAT timeout, pulled cable)
+// The cloud sends a heartbeat on free connections every ~20 seconds, clients and
+// masters exchange their own heartbeats every few seconds (0 = never time out)
+#define FREE_HEARTBEAT_TIMEOUT 65000     // Free connection: replaced when the cloud was silent for 65 seconds
+#define CLIENT_IDLE_TIMEOUT 120000       // Client attached: closed after 2 minutes without data either way
+#define TIMER_WHEEL_TICK 250             // Resolution of these timeouts (see TimerWheel.h)
+
+// Pre-connect: free connections can keep a connection to the master open,
+// so the first data of a client goes out without waiting for a TCP handshake.
+// Every one of them is an idle connection on the master, which only accepts
+// a few, so it's off by default (the budget can be changed in the web interface)
+#define DEVICE_PRECONNECT_BUDGET 0       // Pre-connected master sockets, all routes together (0 = off)
+#define DEVICE_PRECONNECT_RETRY 5000     // After a pre-connect failed or was dropped, wait 5 seconds
+
+// TCP options per kind of connection (can be changed in the web interface)
+// Duotecno frames are small and interactive: waiting to fill a segment (Nagle) only delays them.
+// Keepalive finds connections whose peer vanished without closing them.
+#define CLOUD_TCP_NODELAY true
+#define CLOUD_KEEPALIVE_IDLE 60          // Seconds without traffic before the first probe (0 = no keepalive)
+#define CLOUD_KEEPALIVE_INTERVAL 10      // Seconds between probes
+#define CLOUD_KEEPALIVE_COUNT 3          // Unanswered probes before the connection is dropped
+#define CLOUD_SEND_BUFFER 0              // SO_SNDBUF in bytes (0 = default of the TCP stack)
+#define DEVICE_TCP_NODELAY true
+#define DEVICE_KEEPALIVE_IDLE 30         // The master is on the LAN, a dead one is found sooner
+#define DEVICE_KEEPALIVE_INTERVAL 5
+#define DEVICE_KEEPALIVE_COUNT 3
+#define DEVICE_SEND_BUFFER 0
+
+// Forwarding buffer per direction per connection (2 per connection)
+// Reading from a socket stops while its buffer is full, so a slow receiver
+// slows down the sender through TCP flow control instead of losing data
+// Can be changed in the web interface (after a restart), between these limits
+#define FORWARD_BUFFER_SIZE 2048
+#define FORWARD_BUFFER_MIN 512
+#define FORWARD_BUFFER_MAX 32768
+
+// Put the forwarding buffers in PSRAM when the board has it (BOARD_HAS_PSRAM and found at boot),
+// the connection contexts themselves always stay in internal RAM
+#define FORWARD_BUFFER_PSRAM true
+
+// Once a client is attached, data is received straight into the forwarding buffer.
+// false: read into a buffer on the stack first and copy it in (the old path, one copy more)
+// Compare both with the forwarding CPU time in /status and /metrics
+#define FORWARD_DIRECT_RECV true
+
+// Chunks per forwarding buffer whose queue time is kept for the latency histograms
+#define LATENCY_MARKS 8
+
+// Longest the proxy loop sleeps in select() waiting for socket activity
+// Everything it waits for is a socket or a timer, so this is only a safety net
+#define PROXY_LOOP_MAX_WAIT 1000
+
+// ============================================
+// Tasks
+// ============================================
+
+// The proxy runs in its own task, pinned to core 1 with a high priority:
+// above the Arduino loop and web server (1), below the lwIP task (18)
+#define PROXY_TASK_CORE 1
+#define PROXY_TASK_PRIORITY 10
+#define PROXY_TASK_STACK 8192
+
+// Task watchdog on the proxy task: restarts the ESP32 when its loop hangs for this long
+// (the loop runs at least every PROXY_LOOP_MAX_WAIT ms)
+#define PROXY_WATCHDOG_TIMEOUT 30        // seconds
+
+// The web configuration interface runs on core 0 (together with mDNS and the network stack)
+#define WEB_TASK_CORE 0
+#define WEB_TASK_PRIORITY 1
+#define WEB_TASK_STACK 8192
+
+// How often the proxy task publishes its statistics for the web interface
+#define STATUS_PUBLISH_INTERVAL 250
+
+// Log output: the proxy only queues log records, this task prints them (see LogSink.h)
+#define LOG_TASK_CORE 0
+#define LOG_TASK_PRIORITY 1
+#define LOG_TASK_STACK 4096
+#define LOG_RING_SIZE 64          // Records waiting to be printed (power of 2), more are dropped
+#define LOG_TEXT_SIZE 80          // Longest message, and how much of forwarded data is shown
+#define LOG_DRAIN_INTERVAL 10     // ms between checks for new records when idle
+
 // ============================================
 // Web Server Configuration
 // ============================================
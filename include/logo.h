@@ -1,21 +0,0 @@
-#ifndef LOGO_H
-#define LOGO_H
-
-// Duotecno logo SVG - embedded for web interface
-// Original: Duotecno_logo_black.svg (1550x1599)
-// Optimized for inline use in HTML header
-
-const char DUOTECNO_LOGO_SVG[] PROGMEM = R"rawliteral(
-<svg width="60" height="62" viewBox="0 0 1550 1599" fill="none" xmlns="http://www.w3.org/2000/svg" style="flex-shrink: 0;">
-<path d="M54.6003 5.06515C49.9542 9.71127 46.4696 243.179 46.4696 523.107C46.4696 1023.73 46.4696 1031.86 23.239 1031.86C-6.96081 1031.86 -8.12233 1078.32 22.0774 1086.45C41.8235 1091.1 44.1465 1107.36 48.7926 1279.26C54.6003 1515.05 73.1847 1558.03 177.722 1582.42C206.761 1589.39 209.084 1587.07 209.084 1548.74C209.084 1513.89 205.599 1508.08 181.207 1508.08C163.784 1508.08 142.877 1495.31 128.938 1477.89C106.869 1450.01 104.546 1431.42 104.546 1268.81V1089.93H156.815C204.438 1089.93 209.084 1087.61 209.084 1060.9C209.084 1034.18 204.438 1031.86 156.815 1031.86H104.546L102.223 518.461C98.7384 65.4647 96.4154 3.90362 81.3155 0.419028C70.8617 -0.742501 59.2464 0.419028 54.6003 5.06515Z" fill="currentColor"/>
-<path d="M778.233 216.463V340.747L721.318 361.655C649.303 387.208 586.581 456.9 563.35 537.046C541.281 609.061 541.281 641.583 562.189 711.275C593.55 816.974 679.503 890.151 775.91 895.958L818.887 898.281L822.371 494.069C824.694 96.8259 824.694 91.0182 801.464 91.0182C779.395 91.0182 778.233 97.9874 778.233 216.463ZM778.233 626.483V835.559L752.68 827.428C670.211 803.036 627.234 756.575 604.004 669.46C590.065 618.353 604.004 541.692 636.527 498.715C664.403 460.385 729.449 416.247 756.164 416.247C777.072 416.247 778.233 429.023 778.233 626.483Z" fill="currentColor"/>
-<path d="M1324.15 358.171C1246.33 441.801 1221.94 659.007 1277.69 785.614C1346.22 942.421 1461.21 938.936 1522.77 777.483C1554.14 695.015 1557.62 553.308 1529.74 462.709C1491.41 332.617 1393.84 283.833 1324.15 358.171ZM1450.76 423.217C1487.93 470.84 1501.87 532.401 1496.06 632.292C1489.09 776.322 1439.14 854.144 1374.1 823.945C1284.66 783.291 1269.56 509.17 1350.87 418.571C1382.23 384.886 1421.72 386.048 1450.76 423.217Z" fill="currentColor"/>
-<path d="M917.617 619.516C917.617 884.344 918.778 892.475 940.848 892.475C958.27 892.475 964.078 884.344 964.078 861.114V829.753L996.601 859.952C1063.97 924.998 1138.31 908.737 1160.38 826.268C1167.35 801.876 1173.15 684.561 1173.15 563.762C1173.15 354.687 1171.99 346.556 1149.92 346.556C1127.85 346.556 1126.69 354.687 1126.69 560.278C1126.69 678.754 1122.05 787.938 1115.08 804.199C1101.14 842.529 1062.81 843.691 1009.38 807.684L969.886 780.968L966.401 563.762C964.078 355.848 962.917 346.556 940.848 346.556C918.778 346.556 917.617 355.848 917.617 619.516Z" fill="currentColor"/>
-<path d="M343.821 1048.12C277.614 1117.81 250.899 1265.33 283.422 1391.93C313.621 1509.25 372.859 1570.81 464.62 1580.1C502.951 1583.58 505.274 1581.26 508.758 1545.25C512.243 1510.41 509.92 1508.09 476.236 1508.09C396.09 1508.09 336.852 1438.39 320.591 1324.56L313.621 1275.78H429.774H545.927V1237.45C545.927 1186.34 515.728 1089.93 490.174 1059.73C439.067 999.335 392.605 994.689 343.821 1048.12ZM448.359 1098.07C468.105 1117.81 499.466 1184.02 499.466 1206.09C499.466 1213.06 464.62 1217.7 412.351 1217.7C318.267 1217.7 313.621 1214.22 338.013 1151.5C364.729 1081.8 408.867 1059.73 448.359 1098.07Z" fill="currentColor"/>
-<path d="M1370.61 1016.76C1282.34 1049.28 1225.42 1230.48 1253.3 1387.29C1270.72 1486.02 1305.57 1552.22 1357.84 1582.42C1397.33 1604.49 1397.33 1604.49 1439.14 1582.42C1582.01 1504.6 1588.98 1116.65 1447.27 1030.7C1410.11 1007.47 1399.65 1006.3 1370.61 1016.76ZM1442.63 1107.36C1483.28 1148.01 1501.87 1223.51 1496.06 1330.37C1491.41 1433.75 1465.86 1497.63 1421.72 1518.54C1353.19 1548.74 1298.6 1454.65 1298.6 1307.14C1298.6 1204.93 1316.02 1144.53 1357.84 1102.71C1389.2 1071.35 1407.78 1072.51 1442.63 1107.36Z" fill="currentColor"/>
-<path d="M752.68 1031.86C651.627 1062.06 587.743 1167.76 587.743 1304.82C587.743 1454.65 667.888 1569.65 778.234 1580.1C816.564 1583.58 818.887 1581.26 822.372 1545.25C825.856 1511.57 823.533 1508.09 793.334 1508.09C708.542 1508.09 638.85 1417.49 638.85 1304.82C638.85 1195.63 691.119 1121.3 781.718 1102.71C813.08 1095.74 818.887 1089.93 818.887 1060.9C818.887 1022.57 803.787 1015.6 752.68 1031.86Z" fill="currentColor"/>
-<path d="M1045.39 1033.02C1029.12 1039.99 1004.73 1056.25 990.793 1069.03L964.078 1093.42V1063.22C964.078 1039.99 958.27 1031.86 940.848 1031.86C918.778 1031.86 917.617 1039.99 917.617 1304.82C917.617 1569.65 918.778 1577.78 940.848 1577.78C962.917 1577.78 964.078 1569.65 964.078 1368.7C964.078 1161.95 964.078 1158.46 991.955 1130.59C1034.93 1087.61 1079.07 1080.64 1105.78 1113.16C1124.37 1136.39 1126.69 1163.11 1126.69 1358.25C1126.69 1569.65 1127.85 1577.78 1149.92 1577.78C1171.99 1577.78 1173.15 1569.65 1173.15 1359.41C1173.15 1145.69 1163.86 1069.03 1134.82 1045.8C1110.43 1026.05 1075.59 1021.4 1045.39 1033.02Z" fill="currentColor"/>
-</svg>
-)rawliteral";
-
-#endif // LOGO_H
@@ -0,0 +1,266 @@
+/*
+ * End-to-end throughput benchmark of the proxy, on the host
+ *
+ * Runs the real proxy (ESPProxy + Context, native build) between two local
+ * stand-ins:
+ *  - a fake cloud server: accepts the proxy's connections, reads the
+ *    [uniqueId] registration and keeps them as free connections
+ *  - a fake master: echoes everything it receives
+ *
+ * For every chunk size and connection count, that many simulated clients
+ * each take a free connection and send chunks back to back, waiting for the
+ * echo of one before sending the next. Reported per run: MB/s through the
+ * proxy (both directions counted once, as the bytes a client sent) and the
+ * round trip per chunk (client -> proxy -> master -> proxy -> client).
+ *
+ *   pio run -e native && .pio/build/native/program [seconds per run]
+ *
+ * The proxy logs to stderr, the results go to stdout.
+ *
+ * Author: Johan Coppieters for Duotecno
+ * Date: November 2025
+ */
+
+#include <Arduino.h>
+#include <arpa/inet.h>
+#include <signal.h>
+#include <mutex>
+#include <condition_variable>
+#include <deque>
+#include <thread>
+#include <vector>
+#include "ESPProxy.h"
+#include "LatencyHistogram.h"
+
+static const size_t CHUNK_SIZES[] = { 64, 512, 1460, 4096 };
+static const int CLIENT_COUNTS[] = { 1, 4, 8 };
+
+// Connections the proxy keeps free: enough for the largest run (at most CONNECTION_CAPACITY - 1)
+static const int POOL_SIZE = min(8, CONNECTION_CAPACITY - 1);
+
+static ESPProxy proxy;
+
+///////////////////////
+// Socket boilerplate //
+///////////////////////
+
+// Listening socket on 127.0.0.1, on a port the system picks
+static int listenLocal(uint16_t& port) {
+  int fd = socket(AF_INET, SOCK_STREAM, 0);
+  struct sockaddr_in addr;
+  memset(&addr, 0, sizeof(addr));
+  addr.sin_family = AF_INET;
+  addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  addr.sin_port = 0;
+  if (fd < 0 || bind(fd, (struct sockaddr*)&addr, sizeof(addr)) < 0 || listen(fd, 16) < 0) {
+    perror("[BENCH] listen");
+    exit(1);
+  }
+  socklen_t len = sizeof(addr);
+  getsockname(fd, (struct sockaddr*)&addr, &len);
+  port = ntohs(addr.sin_port);
+  return fd;
+}
+
+static void setNoDelay(int fd) {
+  int one = 1;
+  setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+}
+
+// Blocking, all or nothing
+static bool sendAll(int fd, const uint8_t* data, size_t len) {
+  while (len > 0) {
+    ssize_t sent = send(fd, data, len, 0);
+    if (sent <= 0) return false;
+    data += sent;
+    len -= sent;
+  }
+  return true;
+}
+
+static bool receiveAll(int fd, uint8_t* data, size_t len) {
+  while (len > 0) {
+    ssize_t got = recv(fd, data, len, 0);
+    if (got <= 0) return false;
+    data += got;
+    len -= got;
+  }
+  return true;
+}
+
+/////////////////
+// Fake master //
+/////////////////
+
+static void echoConnection(int fd) {
+  uint8_t buffer[8192];
+  for (;;) {
+    ssize_t got = recv(fd, buffer, sizeof(buffer), 0);
+    if (got <= 0 || !sendAll(fd, buffer, got)) break;
+  }
+  close(fd);
+}
+
+static void masterMain(int listenFd) {
+  for (;;) {
+    int fd = accept(listenFd, nullptr, nullptr);
+    if (fd < 0) continue;
+    setNoDelay(fd);
+    std::thread(echoConnection, fd).detach();
+  }
+}
+
+///////////////////////
+// Fake cloud server //
+///////////////////////
+
+// Registered connections of the proxy, waiting for a client
+static std::mutex freeLock;
+static std::condition_variable freeChanged;
+static std::deque<int> freeConnections;
+
+static void registerConnection(int fd) {
+  // The proxy sends [uniqueId] first
+  char c;
+  do {
+    if (recv(fd, &c, 1, 0) != 1) {
+      close(fd);
+      return;
+    }
+  } while (c != ']');
+
+  std::lock_guard<std::mutex> lock(freeLock);
+  freeConnections.push_back(fd);
+  freeChanged.notify_all();
+}
+
+static void cloudMain(int listenFd) {
+  for (;;) {
+    int fd = accept(listenFd, nullptr, nullptr);
+    if (fd < 0) continue;
+    setNoDelay(fd);
+    std::thread(registerConnection, fd).detach();
+  }
+}
+
+// Wait until the proxy has count free connections, false on timeout
+static bool waitForFree(size_t count, unsigned long timeoutMs) {
+  std::unique_lock<std::mutex> lock(freeLock);
+  return freeChanged.wait_for(lock, std::chrono::milliseconds(timeoutMs),
+                              [count]() { return freeConnections.size() >= count; });
+}
+
+static int takeFree() {
+  std::lock_guard<std::mutex> lock(freeLock);
+  int fd = freeConnections.front();
+  freeConnections.pop_front();
+  return fd;
+}
+
+/////////////
+// Clients //
+/////////////
+
+struct ClientResult {
+  uint64_t bytes;
+  std::vector<uint32_t> roundTrips;  // us
+  bool failed;
+};
+
+static void clientMain(int fd, size_t chunkSize, unsigned long endAt, ClientResult* result) {
+  // Not starting with '[': the proxy sees client data right away
+  std::vector<uint8_t> chunk(chunkSize, 'x');
+  std::vector<uint8_t> echo(chunkSize);
+
+  while (millis() < endAt) {
+    uint32_t start = micros();
+    if (!sendAll(fd, chunk.data(), chunkSize) || !receiveAll(fd, echo.data(), chunkSize)) {
+      result->failed = true;
+      break;
+    }
+    result->roundTrips.push_back(micros() - start);
+    result->bytes += chunkSize;
+  }
+  close(fd);  // the proxy drops the connection and its master connection
+}
+
+static void run(size_t chunkSize, int clients, unsigned long durationMs) {
+  if (!waitForFree(POOL_SIZE, 5000)) {
+    printf("%6u %7d   (proxy has no free connections)\n", (unsigned)chunkSize, clients);
+    return;
+  }
+
+  std::vector<ClientResult> results(clients);
+  std::vector<std::thread> threads;
+  unsigned long start = millis();
+  for (int i = 0; i < clients; i++) {
+    results[i].bytes = 0;
+    results[i].failed = false;
+    threads.push_back(std::thread(clientMain, takeFree(), chunkSize, start + durationMs, &results[i]));
+  }
+  for (size_t i = 0; i < threads.size(); i++) threads[i].join();
+  unsigned long elapsed = millis() - start;
+
+  uint64_t bytes = 0;
+  int failed = 0;
+  LatencyHistogram roundTrip;
+  for (int i = 0; i < clients; i++) {
+    bytes += results[i].bytes;
+    if (results[i].failed) failed++;
+    for (size_t j = 0; j < results[i].roundTrips.size(); j++) roundTrip.record(results[i].roundTrips[j]);
+  }
+  LatencySummary summary;
+  roundTrip.summarize(summary);
+
+  printf("%6u %7d %9.2f %9u %8u %8u %8u%s\n", (unsigned)chunkSize, clients, bytes / 1e6 / (elapsed / 1000.0),
+         summary.count, summary.p50, summary.p99, summary.max, failed ? "  (client connections failed)" : "");
+  fflush(stdout);
+}
+
+int main(int argc, char** argv) {
+  unsigned long durationMs = (argc > 1) ? (unsigned long)(atof(argv[1]) * 1000) : 2000;
+
+  // A client sending on a connection the proxy dropped gets an error, not SIGPIPE
+  signal(SIGPIPE, SIG_IGN);
+
+  uint16_t cloudPort, masterPort;
+  int cloudFd = listenLocal(cloudPort);
+  int masterFd = listenLocal(masterPort);
+  std::thread(cloudMain, cloudFd).detach();
+  std::thread(masterMain, masterFd).detach();
+
+  // Settings as they come from config.h, pointed at the stand-ins
+  ProxyConfig config;
+  memset(&config, 0, sizeof(config));
+  strncpy(config.cloudServer, "127.0.0.1", sizeof(config.cloudServer) - 1);
+  config.cloudPort = cloudPort;
+  config.routeCount = 1;
+  strncpy(config.routes[0].uniqueId, "bench:5001", sizeof(config.routes[0].uniqueId) - 1);
+  strncpy(config.routes[0].masterAddress, "127.0.0.1", sizeof(config.routes[0].masterAddress) - 1);
+  config.routes[0].masterPort = masterPort;
+  config.capacity = CONNECTION_CAPACITY;
+  config.bufferSize = FORWARD_BUFFER_SIZE;
+  config.poolMinFree = POOL_SIZE;
+  config.poolMaxFree = POOL_SIZE;
+  config.preconnect = DEVICE_PRECONNECT_BUDGET;
+  config.cloudSocket = { CLOUD_TCP_NODELAY, CLOUD_KEEPALIVE_IDLE, CLOUD_KEEPALIVE_INTERVAL, CLOUD_KEEPALIVE_COUNT, CLOUD_SEND_BUFFER };
+  config.deviceSocket = { DEVICE_TCP_NODELAY, DEVICE_KEEPALIVE_IDLE, DEVICE_KEEPALIVE_INTERVAL, DEVICE_KEEPALIVE_COUNT, DEVICE_SEND_BUFFER };
+  config.debug = false;
+
+  if (!proxy.begin(config) || !proxy.start()) {
+    fprintf(stderr, "[BENCH] Proxy did not start\n");
+    return 1;
+  }
+
+  printf("Proxy benchmark: %lu ms per run, FORWARD_BUFFER_SIZE %d, %s receive\n", durationMs,
+         FORWARD_BUFFER_SIZE, FORWARD_DIRECT_RECV ? "direct" : "staged");
+  printf(" chunk clients      MB/s    chunks  p50 us  p99 us  max us\n");
+  for (size_t c = 0; c < sizeof(CLIENT_COUNTS) / sizeof(CLIENT_COUNTS[0]); c++) {
+    for (size_t s = 0; s < sizeof(CHUNK_SIZES) / sizeof(CHUNK_SIZES[0]); s++) {
+      run(CHUNK_SIZES[s], min(CLIENT_COUNTS[c], POOL_SIZE), durationMs);
+    }
+  }
+
+  // The proxy task never ends, don't wait for it
+  _exit(0);
+}
@@ -0,0 +1,77 @@
+/*
+ * Throughput benchmark of the frame parser, on the host
+ *
+ * Feeds FrameParser what a free connection gets from the cloud, in reads
+ * of READ_SIZE bytes like the proxy does:
+ *  - a stream of heartbeats ([215,3] frames back to back)
+ *  - long [OK...] responses, where the parser only looks for the ']'
+ * and compares findByte(), 4 bytes per step, with a plain byte loop.
+ *
+ *   pio run -e native_parserbench && .pio/build/native_parserbench/program [seconds per run]
+ *
+ * Author: Johan Coppieters for Duotecno
+ * Date: November 2025
+ */
+
+#include <Arduino.h>
+#include <string>
+#include "FrameParser.h"
+
+static const size_t READ_SIZE = 512;  // read buffer of Context::handleDataFromCloud()
+
+static volatile size_t sink;  // keeps the compiler from dropping the work
+
+// Parse all of text in reads of READ_SIZE, returns the number of frames
+static size_t parseAll(const std::string& text) {
+  FrameParser parser;
+  const uint8_t* data = (const uint8_t*)text.data();
+  size_t frames = 0;
+  for (size_t start = 0; start < text.size(); start += READ_SIZE) {
+    size_t len = min(READ_SIZE, text.size() - start);
+    size_t pos = 0;
+    while (parser.next(data + start, len, pos) != FRAME_NONE) frames++;
+  }
+  return frames;
+}
+
+static size_t byteLoop(const uint8_t* data, size_t len, uint8_t c) {
+  for (size_t i = 0; i < len; i++) {
+    if (data[i] == c) return i;
+  }
+  return len;
+}
+
+// Runs work over bytes of input for about durationMs, prints MB/s
+template <typename Work>
+static void measure(const char* name, size_t bytes, unsigned long durationMs, Work work) {
+  size_t runs = 0;
+  unsigned long start = micros();
+  unsigned long elapsed;
+  do {
+    sink = work();
+    runs++;
+    elapsed = micros() - start;
+  } while (elapsed < durationMs * 1000);
+  printf("%-30s %9.1f MB/s\n", name, (double)bytes * runs / elapsed);
+}
+
+int main(int argc, char** argv) {
+  unsigned long durationMs = (argc > 1) ? (unsigned long)(atof(argv[1]) * 1000) : 1000;
+
+  std::string heartbeats;
+  while (heartbeats.size() < 1024 * 1024) heartbeats += "[215,3]";
+
+  std::string responses;
+  while (responses.size() < 1024 * 1024) responses += "[OK," + std::string(4000, 'a') + "]";
+
+  std::string noBracket(64 * 1024, 'a');
+  const uint8_t* text = (const uint8_t*)noBracket.data();
+
+  printf("Frame parser benchmark: %lu ms per run, reads of %u bytes\n", durationMs, (unsigned)READ_SIZE);
+  measure("heartbeats", heartbeats.size(), durationMs, [&]() { return parseAll(heartbeats); });
+  measure("long responses", responses.size(), durationMs, [&]() { return parseAll(responses); });
+  measure("findByte (4 bytes per step)", noBracket.size(), durationMs,
+          [&]() { return FrameParser::findByte(text, noBracket.size(), ']'); });
+  measure("byte loop", noBracket.size(), durationMs, [&]() { return byteLoop(text, noBracket.size(), ']'); });
+  return 0;
+}
@@ -0,0 +1,123 @@
+/*
+ * The proxy as a host program, for load and soak tests
+ *
+ * Runs the real proxy (ESPProxy + Context, native build) with the cloud
+ * server and the masters given on the command line, so tools/cloudsim.py
+ * (or a real cloud) can be pointed at it like at the ESP32:
+ *
+ *   pio run -e native_proxy
+ *   .pio/build/native_proxy/program [options] <cloud host> <cloud port> <uniqueId>=<master ip>:<port> ...
+ *
+ * One <uniqueId>=<master ip>:<port> per route (at most MAX_ROUTES), the
+ * first one is the main master. Options, the defaults come from config.h:
+ *   -n slots       connection slots (CONNECTION_CAPACITY)
+ *   -b bytes       forwarding buffer per direction (FORWARD_BUFFER_SIZE)
+ *   -m count       minimum free connections per route (POOL_MIN_FREE)
+ *   -M count       maximum free connections per route (POOL_MAX_FREE)
+ *   -w count       pre-connected master sockets (DEVICE_PRECONNECT_BUDGET)
+ *   -r seconds     print a status line every this many seconds (0 = never)
+ *   -d             debug logging
+ *
+ * The proxy logs to stderr, the status lines go to stdout.
+ *
+ * Author: Johan Coppieters for Duotecno
+ * Date: November 2025
+ */
+
+#include <Arduino.h>
+#include <unistd.h>
+#include "ESPProxy.h"
+
+static ESPProxy proxy;
+static ProxyStatus status;  // too big for the stack
+
+static void usage(const char* program) {
+  fprintf(stderr, "Usage: %s [-n slots] [-b bytes] [-m minFree] [-M maxFree] [-w preconnect] [-r seconds] [-d]\n"
+                  "       <cloud host> <cloud port> <uniqueId>=<master ip>:<port> ...\n", program);
+  exit(2);
+}
+
+// <uniqueId>=<master ip>:<port>, the unique ID may hold ':' itself
+static bool parseRoute(const char* text, RouteConfig& route) {
+  const char* equals = strchr(text, '=');
+  const char* colon = strrchr(text, ':');
+  if (!equals || !colon || colon < equals) return false;
+
+  size_t idLen = equals - text;
+  size_t addressLen = colon - equals - 1;
+  if (idLen == 0 || idLen >= sizeof(route.uniqueId) || addressLen >= sizeof(route.masterAddress)) return false;
+
+  memset(&route, 0, sizeof(route));
+  memcpy(route.uniqueId, text, idLen);
+  memcpy(route.masterAddress, equals + 1, addressLen);
+  route.masterPort = atoi(colon + 1);
+
+  IPAddress ip;
+  return route.masterPort > 0 && ip.fromString(route.masterAddress);
+}
+
+static void printStatus() {
+  if (!proxy.getStatus(status)) return;
+  printf("[PROXY] %lu s: %u free, %u active, %llu clients, %llu bytes, timeouts %lu/%lu/%lu, outages %lu\n",
+         millis() / 1000, (unsigned)status.freeConnections, (unsigned)status.activeConnections,
+         (unsigned long long)status.clientConnections, (unsigned long long)status.bytesTransferred,
+         (unsigned long)status.connectTimeouts, (unsigned long)status.heartbeatTimeouts,
+         (unsigned long)status.idleTimeouts, (unsigned long)status.outages);
+  fflush(stdout);
+}
+
+int main(int argc, char** argv) {
+  ProxyConfig config;
+  memset(&config, 0, sizeof(config));
+  config.capacity = CONNECTION_CAPACITY;
+  config.bufferSize = FORWARD_BUFFER_SIZE;
+  config.poolMinFree = POOL_MIN_FREE;
+  config.poolMaxFree = POOL_MAX_FREE;
+  config.preconnect = DEVICE_PRECONNECT_BUDGET;
+  config.cloudSocket = { CLOUD_TCP_NODELAY, CLOUD_KEEPALIVE_IDLE, CLOUD_KEEPALIVE_INTERVAL, CLOUD_KEEPALIVE_COUNT, CLOUD_SEND_BUFFER };
+  config.deviceSocket = { DEVICE_TCP_NODELAY, DEVICE_KEEPALIVE_IDLE, DEVICE_KEEPALIVE_INTERVAL, DEVICE_KEEPALIVE_COUNT, DEVICE_SEND_BUFFER };
+  config.debug = false;
+  unsigned long reportSeconds = 30;
+
+  int option;
+  while ((option = getopt(argc, argv, "n:b:m:M:w:r:d")) != -1) {
+    switch (option) {
+      case 'n': config.capacity = atoi(optarg); break;
+      case 'b': config.bufferSize = atoi(optarg); break;
+      case 'm': config.poolMinFree = atoi(optarg); break;
+      case 'M': config.poolMaxFree = atoi(optarg); break;
+      case 'w': config.preconnect = atoi(optarg); break;
+      case 'r': reportSeconds = atoi(optarg); break;
+      case 'd': config.debug = true; break;
+      default: usage(argv[0]);
+    }
+  }
+
+  int routes = argc - optind - 2;
+  if (routes < 1 || routes > MAX_ROUTES) usage(argv[0]);
+
+  strncpy(config.cloudServer, argv[optind], sizeof(config.cloudServer) - 1);
+  config.cloudPort = atoi(argv[optind + 1]);
+  for (int r = 0; r < routes; r++) {
+    if (!parseRoute(argv[optind + 2 + r], config.routes[r])) {
+      fprintf(stderr, "[PROXY] Not a route: %s (expected <uniqueId>=<master ip>:<port>)\n", argv[optind + 2 + r]);
+      return 2;
+    }
+  }
+  config.routeCount = routes;
+
+  if (!proxy.begin(config) || !proxy.start()) {
+    fprintf(stderr, "[PROXY] Proxy did not start\n");
+    return 1;
+  }
+
+  // The proxy runs in its own task, until the program is stopped
+  for (;;) {
+    if (reportSeconds > 0) {
+      delay(reportSeconds * 1000);
+      printStatus();
+    } else {
+      delay(1000);
+    }
+  }
+}
@@ -0,0 +1,91 @@
+#include <Arduino.h>
+#include <ETH.h>
+#include <stdarg.h>
+#include <time.h>
+#include <arpa/inet.h>
+
+HardwareSerial Serial;
+EspClass ESP;
+ETHClass ETH;
+
+static uint64_t nowMicros() {
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return (uint64_t)now.tv_sec * 1000000ULL + now.tv_nsec / 1000;
+}
+
+// Like on the ESP32, the clock starts at 0
+static const uint64_t startMicros = nowMicros();
+
+unsigned long millis() {
+  return (unsigned long)((nowMicros() - startMicros) / 1000);
+}
+
+unsigned long micros() {
+  return (unsigned long)(nowMicros() - startMicros);
+}
+
+void delay(unsigned long ms) {
+  struct timespec wait = { (time_t)(ms / 1000), (long)(ms % 1000) * 1000000L };
+  nanosleep(&wait, nullptr);
+}
+
+long random(long howBig) {
+  return howBig > 0 ? rand() % howBig : 0;
+}
+
+long random(long howSmall, long howBig) {
+  return howSmall + random(howBig - howSmall);
+}
+
+///////////
+// Print //
+///////////
+
+size_t Print::write(uint8_t c) { return fputc(c, stderr) == EOF ? 0 : 1; }
+size_t Print::write(const uint8_t* buffer, size_t len) { return fwrite(buffer, 1, len, stderr); }
+size_t Print::print(const char* s) { return fputs(s, stderr) < 0 ? 0 : strlen(s); }
+size_t Print::print(char c) { return this->write((uint8_t)c); }
+size_t Print::print(int value) { return this->printf("%d", value); }
+size_t Print::print(unsigned int value) { return this->printf("%u", value); }
+size_t Print::print(long value) { return this->printf("%ld", value); }
+size_t Print::print(unsigned long value) { return this->printf("%lu", value); }
+size_t Print::println(const char* s) { return this->print(s) + this->print('\n'); }
+size_t Print::println(int value) { return this->print(value) + this->print('\n'); }
+size_t Print::println(unsigned int value) { return this->print(value) + this->print('\n'); }
+size_t Print::println(long value) { return this->print(value) + this->print('\n'); }
+size_t Print::println(unsigned long value) { return this->print(value) + this->print('\n'); }
+
+size_t Print::printf(const char* format, ...) {
+  va_list args;
+  va_start(args, format);
+  int len = vfprintf(stderr, format, args);
+  va_end(args);
+  return len < 0 ? 0 : len;
+}
+
+///////////////
+// IPAddress //
+///////////////
+
+IPAddress::IPAddress(uint8_t a, uint8_t b, uint8_t c, uint8_t d) {
+  this->address = (uint32_t)a | ((uint32_t)b << 8) | ((uint32_t)c << 16) | ((uint32_t)d << 24);
+}
+
+bool IPAddress::fromString(const char* text) {
+  struct in_addr parsed;
+  if (inet_pton(AF_INET, text, &parsed) != 1) return false;
+  this->address = parsed.s_addr;
+  return true;
+}
+
+String IPAddress::toString() const {
+  char text[16];
+  snprintf(text, sizeof(text), "%u.%u.%u.%u", (*this)[0], (*this)[1], (*this)[2], (*this)[3]);
+  return String(text);
+}
+
+void EspClass::restart() {
+  Serial.println("[NATIVE] ESP.restart() - exiting");
+  exit(1);
+}
@@ -0,0 +1,98 @@
+/*
+ * Arduino core shim for the host (native) build
+ *
+ * Just enough of the Arduino API for the proxy core (ESPProxy, Context,
+ * LogSink, DnsCache, FrameParser) to build and run on Linux/macOS: time,
+ * Serial (written to stderr, so a program's own output stays clean),
+ * String, IPAddress and the few ESP calls used for statistics.
+ *
+ * The sockets need no shim: without ARDUINO, SocketUtil.h and TaskUtil.h
+ * use the system sockets and pthreads.
+ *
+ * Author: Johan Coppieters for Duotecno
+ * Date: November 2025
+ */
+
+#ifndef NATIVE_ARDUINO_H
+#define NATIVE_ARDUINO_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <algorithm>
+#include "WString.h"
+
+using std::min;
+using std::max;
+
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+
+#define PROGMEM
+typedef const char* PGM_P;
+
+#define HIGH 1
+#define LOW 0
+#define OUTPUT 1
+inline void pinMode(int pin, int mode) {}
+inline void digitalWrite(int pin, int value) {}
+
+unsigned long millis();  // Since the program started
+unsigned long micros();
+void delay(unsigned long ms);
+long random(long howBig);
+long random(long howSmall, long howBig);
+
+class Print {
+public:
+  size_t write(uint8_t c);
+  size_t write(const uint8_t* buffer, size_t len);
+  size_t print(const char* s);
+  size_t print(const String& s) { return this->print(s.c_str()); }
+  size_t print(char c);
+  size_t print(int value);
+  size_t print(unsigned int value);
+  size_t print(long value);
+  size_t print(unsigned long value);
+  size_t println(const char* s = "");
+  size_t println(const String& s) { return this->println(s.c_str()); }
+  size_t println(int value);
+  size_t println(unsigned int value);
+  size_t println(long value);
+  size_t println(unsigned long value);
+  size_t printf(const char* format, ...) __attribute__((format(printf, 2, 3)));
+};
+
+class HardwareSerial : public Print {
+public:
+  void begin(unsigned long baud) {}
+};
+extern HardwareSerial Serial;
+
+class IPAddress {
+public:
+  IPAddress() : address(0) {}
+  IPAddress(uint8_t a, uint8_t b, uint8_t c, uint8_t d);
+  IPAddress(uint32_t address) : address(address) {}  // Network byte order, as lwIP keeps it
+  
+  bool fromString(const char* text);
+  String toString() const;
+  operator uint32_t() const { return address; }
+  uint8_t operator[](int index) const { return (uint8_t)(address >> (8 * index)); }
+  
+private:
+  uint32_t address;
+};
+
+class EspClass {
+public:
+  void restart();  // Ends the program, there is nothing to restart into
+  uint32_t getFreeHeap() { return 0; }
+  uint32_t getMinFreeHeap() { return 0; }
+  uint32_t getMaxAllocHeap() { return 0; }
+};
+extern EspClass ESP;
+
+#endif // NATIVE_ARDUINO_H
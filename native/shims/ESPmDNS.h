@@ -0,0 +1,20 @@
+/*
+ * ESPmDNS shim for the host (native) build: nothing is announced
+ *
+ * Author: Johan Coppieters for Duotecno
+ * Date: November 2025
+ */
+
+#ifndef NATIVE_ESPMDNS_H
+#define NATIVE_ESPMDNS_H
+
+#include <Arduino.h>
+
+class MDNSResponder {
+public:
+  bool begin(const char* hostName) { return true; }
+  void addService(const char* service, const char* proto, uint16_t port) {}
+};
+extern MDNSResponder MDNS;
+
+#endif // NATIVE_ESPMDNS_H
@@ -0,0 +1,26 @@
+/*
+ * ETH shim for the host (native) build
+ *
+ * The Ethernet setup itself lives in main.cpp, which is not part of the
+ * native build. The web interface only asks ETH for the link state and the
+ * address, reported here as a link that is up on 127.0.0.1.
+ *
+ * Author: Johan Coppieters for Duotecno
+ * Date: November 2025
+ */
+
+#ifndef NATIVE_ETH_H
+#define NATIVE_ETH_H
+
+#include <Arduino.h>
+
+class ETHClass {
+public:
+  IPAddress localIP() { return IPAddress(127, 0, 0, 1); }
+  bool linkUp() { return true; }
+  uint8_t linkSpeed() { return 100; }
+  bool fullDuplex() { return true; }
+};
+extern ETHClass ETH;
+
+#endif // NATIVE_ETH_H
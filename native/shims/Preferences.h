@@ -0,0 +1,34 @@
+/*
+ * Preferences (NVS) shim for the host (native) build
+ *
+ * Nothing is stored: every key is missing, so the web interface falls back
+ * to the defaults of config.h, and saving always "succeeds".
+ *
+ * Author: Johan Coppieters for Duotecno
+ * Date: November 2025
+ */
+
+#ifndef NATIVE_PREFERENCES_H
+#define NATIVE_PREFERENCES_H
+
+#include <Arduino.h>
+
+class Preferences {
+public:
+  bool begin(const char* name, bool readOnly = false) { return true; }
+  void end() {}
+
+  bool isKey(const char* key) { return false; }
+  bool remove(const char* key) { return true; }
+
+  String getString(const char* key, const String& defaultValue = String()) { return defaultValue; }
+  uint16_t getUShort(const char* key, uint16_t defaultValue = 0) { return defaultValue; }
+  bool getBool(const char* key, bool defaultValue = false) { return defaultValue; }
+
+  size_t putString(const char* key, const char* value) { return strlen(value); }
+  size_t putString(const char* key, const String& value) { return value.length(); }
+  size_t putUShort(const char* key, uint16_t value) { return 2; }
+  size_t putBool(const char* key, bool value) { return 1; }
+};
+
+#endif // NATIVE_PREFERENCES_H
@@ -0,0 +1,141 @@
+#include <Arduino.h>
+#include <ctype.h>
+
+String::String(const char* text) : heap(nullptr), capacity(0), len(0) {
+  sso[0] = '\0';
+  if (text) this->assign(text, strlen(text));
+}
+
+String::String(const String& other) : heap(nullptr), capacity(0), len(0) {
+  sso[0] = '\0';
+  this->assign(other.c_str(), other.length());
+}
+
+String::String(char c) : heap(nullptr), capacity(0), len(0) {
+  sso[0] = '\0';
+  this->assign(&c, 1);
+}
+
+// Numbers: printed in a local buffer first, like the ESP32 core does
+static void formatNumber(char* text, size_t size, unsigned long long value, bool negative, unsigned char base) {
+  char digits[66];
+  int i = sizeof(digits) - 1;
+  digits[i] = '\0';
+  do {
+    int digit = value % base;
+    digits[--i] = (digit < 10) ? '0' + digit : 'a' + digit - 10;
+    value /= base;
+  } while (value > 0);
+  if (negative) digits[--i] = '-';
+  snprintf(text, size, "%s", digits + i);
+}
+
+#define STRING_FROM_NUMBER(type, negative, magnitude)     \
+  String::String(type value, unsigned char base) : heap(nullptr), capacity(0), len(0) { \
+    char text[66];                                         \
+    formatNumber(text, sizeof(text), magnitude, negative, base); \
+    this->assign(text, strlen(text));                      \
+  }
+
+STRING_FROM_NUMBER(int, value < 0, value < 0 ? -(unsigned long long)value : value)
+STRING_FROM_NUMBER(unsigned int, false, value)
+STRING_FROM_NUMBER(long, value < 0, value < 0 ? -(unsigned long long)value : value)
+STRING_FROM_NUMBER(unsigned long, false, value)
+STRING_FROM_NUMBER(long long, value < 0, value < 0 ? -(unsigned long long)value : value)
+STRING_FROM_NUMBER(unsigned long long, false, value)
+
+String::String(float value, unsigned int decimals) : heap(nullptr), capacity(0), len(0) {
+  char text[48];
+  snprintf(text, sizeof(text), "%.*f", (int)decimals, value);
+  this->assign(text, strlen(text));
+}
+
+String::String(double value, unsigned int decimals) : heap(nullptr), capacity(0), len(0) {
+  char text[48];
+  snprintf(text, sizeof(text), "%.*f", (int)decimals, value);
+  this->assign(text, strlen(text));
+}
+
+String::~String() {
+  delete[] this->heap;
+}
+
+String& String::operator=(const String& other) {
+  if (this != &other) this->assign(other.c_str(), other.length());
+  return *this;
+}
+
+String& String::operator=(const char* text) {
+  this->assign(text ? text : "", text ? strlen(text) : 0);
+  return *this;
+}
+
+String& String::operator+=(const char* text) {
+  if (text) this->concat(text, strlen(text));
+  return *this;
+}
+
+void String::assign(const char* text, size_t len) {
+  this->len = 0;
+  this->concat(text, len);
+}
+
+// Room for size characters: exactly that much, as a new block
+bool String::reserve(size_t size) {
+  if (this->heap ? size <= this->capacity : size <= SSO_SIZE) return true;
+
+  char* block = new char[size + 1];
+  memcpy(block, this->c_str(), this->len + 1);
+  delete[] this->heap;
+  this->heap = block;
+  this->capacity = size;
+  return true;
+}
+
+bool String::concat(const char* text, size_t len) {
+  size_t newLen = this->len + len;
+  if (!this->reserve(newLen)) return false;
+  char* buffer = this->heap ? this->heap : this->sso;
+  memmove(buffer + this->len, text, len);
+  this->len = newLen;
+  buffer[newLen] = '\0';
+  return true;
+}
+
+String operator+(const String& a, const String& b) {
+  String sum(a);
+  sum += b;
+  return sum;
+}
+
+String operator+(const String& a, const char* b) {
+  String sum(a);
+  sum += b;
+  return sum;
+}
+
+String operator+(const char* a, const String& b) {
+  String sum(a);
+  sum += b;
+  return sum;
+}
+
+bool String::equals(const char* text) const {
+  return strcmp(this->c_str(), text ? text : "") == 0;
+}
+
+long String::toInt() const {
+  return atol(this->c_str());
+}
+
+void String::trim() {
+  const char* text = this->c_str();
+  size_t start = 0;
+  size_t end = this->len;
+  while (start < end && isspace((unsigned char)text[start])) start++;
+  while (end > start && isspace((unsigned char)text[end - 1])) end--;
+  char* buffer = this->heap ? this->heap : this->sso;
+  memmove(buffer, text + start, end - start);
+  this->len = end - start;
+  buffer[this->len] = '\0';
+}
@@ -0,0 +1,70 @@
+/*
+ * Arduino String shim for the host (native) build
+ *
+ * Behaves like the String of the ESP32 core where it matters for the heap:
+ * up to SSO_SIZE characters are kept inside the object, longer text gets a
+ * heap block of exactly the length needed, reallocated on every append that
+ * doesn't fit (new[] + copy, so a replaced operator new sees each one).
+ *
+ * Author: Johan Coppieters for Duotecno
+ * Date: November 2025
+ */
+
+#ifndef NATIVE_WSTRING_H
+#define NATIVE_WSTRING_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+class String {
+public:
+  String(const char* text = "");
+  String(const String& other);
+  explicit String(char c);
+  explicit String(int value, unsigned char base = 10);
+  explicit String(unsigned int value, unsigned char base = 10);
+  explicit String(long value, unsigned char base = 10);
+  explicit String(unsigned long value, unsigned char base = 10);
+  explicit String(long long value, unsigned char base = 10);
+  explicit String(unsigned long long value, unsigned char base = 10);
+  explicit String(float value, unsigned int decimals = 2);
+  explicit String(double value, unsigned int decimals = 2);
+  ~String();
+
+  String& operator=(const String& other);
+  String& operator=(const char* text);
+
+  bool concat(const char* text, size_t len);
+  String& operator+=(const String& other) { this->concat(other.c_str(), other.length()); return *this; }
+  String& operator+=(const char* text);
+  String& operator+=(char c) { this->concat(&c, 1); return *this; }
+
+  friend String operator+(const String& a, const String& b);
+  friend String operator+(const String& a, const char* b);
+  friend String operator+(const char* a, const String& b);
+
+  bool equals(const char* text) const;
+  bool operator==(const char* text) const { return this->equals(text); }
+  bool operator==(const String& other) const { return this->equals(other.c_str()); }
+  bool operator!=(const char* text) const { return !this->equals(text); }
+
+  const char* c_str() const { return heap ? heap : sso; }
+  size_t length() const { return len; }
+  bool isEmpty() const { return len == 0; }
+
+  long toInt() const;
+  void trim();
+
+private:
+  static const size_t SSO_SIZE = 11;  // Like the 32 bit ESP32 core
+
+  char sso[SSO_SIZE + 1];
+  char* heap;       // nullptr while the text fits in sso
+  size_t capacity;  // Characters that fit in heap
+  size_t len;
+
+  void assign(const char* text, size_t len);
+  bool reserve(size_t size);
+};
+
+#endif // NATIVE_WSTRING_H
@@ -0,0 +1,44 @@
+#include <WebServer.h>
+#include <ESPmDNS.h>
+
+MDNSResponder MDNS;
+WebServer* WebServer::last = nullptr;
+
+void WebServer::on(const char* uri, HTTPMethod method, THandlerFunction handler) {
+  Route route = { uri, method, handler };
+  this->routes.push_back(route);
+}
+
+void WebServer::send(int code, const char* contentType, const String& content) {
+  this->responseCode = code;
+  this->sendContent(content.c_str(), content.length());
+}
+
+void WebServer::send_P(int code, PGM_P contentType, PGM_P content, size_t len) {
+  this->responseCode = code;
+  this->sendContent(content, len);
+}
+
+void WebServer::sendContent(const char* content, size_t len) {
+  if (len == 0) return;
+  this->responseBytes += len;
+  this->responseChunks++;
+}
+
+bool WebServer::request(HTTPMethod method, const char* uri) {
+  this->currentMethod = method;
+  this->currentUri = uri;
+  this->responseCode = 0;
+  this->responseBytes = 0;
+  this->responseChunks = 0;
+
+  for (size_t i = 0; i < this->routes.size(); i++) {
+    const Route& route = this->routes[i];
+    if (strcmp(route.uri, uri) == 0 && (route.method == HTTP_ANY || route.method == method)) {
+      route.handler();
+      return true;
+    }
+  }
+  if (this->notFound) this->notFound();
+  return false;
+}
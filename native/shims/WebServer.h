@@ -0,0 +1,80 @@
+/*
+ * WebServer shim for the host (native) build
+ *
+ * Nothing listens on a port: request() runs the handler of a URI as if a
+ * browser asked for it. What the handler sends is not kept, only counted
+ * (status code, body bytes, chunks), so a benchmark can call it in a loop
+ * without the shim allocating anything.
+ *
+ * Author: Johan Coppieters for Duotecno
+ * Date: November 2025
+ */
+
+#ifndef NATIVE_WEBSERVER_H
+#define NATIVE_WEBSERVER_H
+
+#include <Arduino.h>
+#include <functional>
+#include <vector>
+
+enum HTTPMethod { HTTP_ANY, HTTP_GET, HTTP_POST };
+
+#define CONTENT_LENGTH_UNKNOWN ((size_t)-1)
+
+class WebServer {
+public:
+  typedef std::function<void(void)> THandlerFunction;
+
+  WebServer(int port) : responseCode(0), responseBytes(0), responseChunks(0), currentMethod(HTTP_GET), currentUri(nullptr) {
+    last = this;
+  }
+
+  void on(const char* uri, THandlerFunction handler) { this->on(uri, HTTP_ANY, handler); }
+  void on(const char* uri, HTTPMethod method, THandlerFunction handler);
+  void onNotFound(THandlerFunction handler) { this->notFound = handler; }
+  void collectHeaders(const char* headers[], size_t count) {}
+
+  void begin() {}
+  void stop() {}
+  void handleClient() {}
+
+  // The request being handled: no arguments or headers
+  HTTPMethod method() { return this->currentMethod; }
+  String uri() { return String(this->currentUri); }
+  bool hasArg(const String& name) { return false; }
+  String arg(const String& name) { return String(); }
+  bool hasHeader(const String& name) { return false; }
+  String header(const String& name) { return String(); }
+
+  void setContentLength(size_t len) {}
+  void sendHeader(const String& name, const String& value, bool first = false) {}
+  void send(int code, const char* contentType = nullptr, const String& content = String());
+  void send_P(int code, PGM_P contentType, PGM_P content, size_t len);
+  void sendContent(const char* content, size_t len);
+  void sendContent(const String& content) { this->sendContent(content.c_str(), content.length()); }
+
+  // Host only: handle a request for uri, false if nothing handled it
+  bool request(HTTPMethod method, const char* uri);
+
+  // Host only: the server created last (WebConfig keeps its own to itself)
+  static WebServer* last;
+
+  // The last response
+  int responseCode;
+  size_t responseBytes;
+  size_t responseChunks;
+
+private:
+  struct Route {
+    const char* uri;
+    HTTPMethod method;
+    THandlerFunction handler;
+  };
+
+  std::vector<Route> routes;
+  THandlerFunction notFound;
+  HTTPMethod currentMethod;
+  const char* currentUri;
+};
+
+#endif // NATIVE_WEBSERVER_H
@@ -0,0 +1,20 @@
+#include <lwip/dns.h>
+#include <string.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+
+err_t dns_gethostbyname(const char* hostname, ip_addr_t* addr, dns_found_callback found, void* callback_arg) {
+  struct addrinfo hints;
+  memset(&hints, 0, sizeof(hints));
+  hints.ai_family = AF_INET;
+  hints.ai_socktype = SOCK_STREAM;
+  
+  struct addrinfo* result = nullptr;
+  if (getaddrinfo(hostname, nullptr, &hints, &result) != 0 || !result) return ERR_ARG;
+  
+  addr->u_addr.ip4.addr = ((struct sockaddr_in*)result->ai_addr)->sin_addr.s_addr;
+  addr->type = 0;
+  freeaddrinfo(result);
+  return ERR_OK;
+}
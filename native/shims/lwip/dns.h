@@ -0,0 +1,32 @@
+/*
+ * lwIP resolver shim for the host (native) build
+ *
+ * dns_gethostbyname() answers through getaddrinfo(), always immediately
+ * (ERR_OK) or with an error, never with ERR_INPROGRESS: the callback is
+ * never called.
+ *
+ * Author: Johan Coppieters for Duotecno
+ * Date: November 2025
+ */
+
+#ifndef NATIVE_LWIP_DNS_H
+#define NATIVE_LWIP_DNS_H
+
+#include <stdint.h>
+
+typedef int8_t err_t;
+#define ERR_OK 0
+#define ERR_INPROGRESS -5
+#define ERR_ARG -16
+
+typedef struct { uint32_t addr; } ip4_addr_t;  // Network byte order
+typedef struct {
+  union { ip4_addr_t ip4; } u_addr;
+  uint8_t type;
+} ip_addr_t;
+
+typedef void (*dns_found_callback)(const char* name, const ip_addr_t* ipaddr, void* callback_arg);
+
+err_t dns_gethostbyname(const char* hostname, ip_addr_t* addr, dns_found_callback found, void* callback_arg);
+
+#endif // NATIVE_LWIP_DNS_H
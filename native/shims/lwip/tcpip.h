@@ -0,0 +1,14 @@
+/*
+ * lwIP core lock shim for the host (native) build: there is no lwIP thread
+ *
+ * Author: Johan Coppieters for Duotecno
+ * Date: November 2025
+ */
+
+#ifndef NATIVE_LWIP_TCPIP_H
+#define NATIVE_LWIP_TCPIP_H
+
+#define LOCK_TCPIP_CORE()
+#define UNLOCK_TCPIP_CORE()
+
+#endif // NATIVE_LWIP_TCPIP_H
@@ -0,0 +1,257 @@
+/*
+ * /status benchmark, on the host: heap allocations and time per request
+ *
+ * Compares the two ways the web interface has written its /status JSON:
+ *  - streamed: WebConfig as it is, through ChunkedWriter (512 byte buffer,
+ *    sent as chunks)
+ *  - String: the generateStatusJSON() it replaced, kept below, which built
+ *    the whole document with String concatenations and sent it at once
+ *
+ * The proxy runs with a fake cloud server that accepts its connections and
+ * keeps them, so the status has a slot entry for every free connection.
+ * Every heap allocation of the request is counted (operator new; the String
+ * shim allocates like the ESP32 core: a block of exactly the new length on
+ * every append that doesn't fit). The WebServer shim doesn't allocate, the
+ * allocations of the real WebServer for headers come on top of both.
+ *
+ * The old document has fewer fields than today's, both sizes are printed.
+ *
+ *   pio run -e native_statusbench && .pio/build/native_statusbench/program [requests]
+ *
+ * Author: Johan Coppieters for Duotecno
+ * Date: November 2025
+ */
+
+#include <Arduino.h>
+#include <arpa/inet.h>
+#include <new>
+#include <thread>
+#include <vector>
+#include "ESPProxy.h"
+#include "WebConfig.h"
+
+static const int POOL_SIZE = CONNECTION_CAPACITY - 1;
+
+static ESPProxy proxy;
+
+/////////////////////////
+// Counted allocations //
+/////////////////////////
+
+// Only the allocations of the thread that measures, not those of the proxy task
+static thread_local bool counting = false;
+static size_t allocations = 0;
+static size_t allocatedBytes = 0;
+
+void* operator new(size_t size) {
+  if (counting) {
+    allocations++;
+    allocatedBytes += size;
+  }
+  void* memory = malloc(size ? size : 1);
+  if (!memory) throw std::bad_alloc();
+  return memory;
+}
+
+void* operator new[](size_t size) {
+  return operator new(size);
+}
+
+void operator delete(void* memory) noexcept {
+  free(memory);
+}
+
+void operator delete[](void* memory) noexcept {
+  free(memory);
+}
+
+///////////////////////
+// Fake cloud server //
+///////////////////////
+
+static void cloudMain(int listenFd) {
+  // Keeps every connection open without reading: they stay free connections
+  std::vector<int> connections;
+  for (;;) {
+    int fd = accept(listenFd, nullptr, nullptr);
+    if (fd >= 0) connections.push_back(fd);
+  }
+}
+
+static int listenLocal(uint16_t& port) {
+  int fd = socket(AF_INET, SOCK_STREAM, 0);
+  struct sockaddr_in addr;
+  memset(&addr, 0, sizeof(addr));
+  addr.sin_family = AF_INET;
+  addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  if (fd < 0 || bind(fd, (struct sockaddr*)&addr, sizeof(addr)) < 0 || listen(fd, 16) < 0) {
+    perror("[BENCH] listen");
+    exit(1);
+  }
+  socklen_t len = sizeof(addr);
+  getsockname(fd, (struct sockaddr*)&addr, &len);
+  port = ntohs(addr.sin_port);
+  return fd;
+}
+
+///////////////////////////////////
+// /status as it was: one String //
+///////////////////////////////////
+
+static String trafficJSON(const Traffic& traffic) {
+  return "{\"bytes\":" + String(traffic.bytes) + ",\"chunks\":" + String(traffic.chunks) + "}";
+}
+
+static String latencyJSON(const LatencySummary& latency) {
+  return "{\"count\":" + String(latency.count) + ",\"p50\":" + String(latency.p50) +
+         ",\"p90\":" + String(latency.p90) + ",\"p99\":" + String(latency.p99) +
+         ",\"max\":" + String(latency.max) + "}";
+}
+
+static String generateStatusJSON() {
+  static ProxyStatus status;  // too big for the stack, like WebConfig::status
+  if (!proxy.getStatus(status)) memset(&status, 0, sizeof(status));
+  const ProxyConfig& config = proxy.getConfig();
+
+  String json = "{";
+  json += "\"connectionCount\":" + String(status.activeConnections) + ",";
+  json += "\"freeConnections\":" + String(status.freeConnections) + ",";
+  json += "\"maxConnections\":" + String(status.capacity) + ",";
+  json += "\"bufferSize\":" + String(status.bufferSize) + ",";
+  json += "\"bytesTransferred\":" + String(status.bytesTransferred) + ",";
+  json += "\"clientConnections\":" + String(status.clientConnections) + ",";
+  json += "\"toDevice\":" + trafficJSON(status.toDevice) + ",";
+  json += "\"toCloud\":" + trafficJSON(status.toCloud) + ",";
+  json += "\"latency\":{";
+  json += "\"toDevice\":" + latencyJSON(status.latencyToDevice) + ",";
+  json += "\"toCloud\":" + latencyJSON(status.latencyToCloud);
+  json += "},";
+  json += "\"pool\":{";
+  json += "\"minFree\":" + String(config.poolMinFree) + ",";
+  json += "\"maxFree\":" + String(config.poolMaxFree) + ",";
+  json += "\"target\":" + String(status.poolTarget) + ",";
+  json += "\"arrivalRate\":" + String(status.arrivalRate, 3) + ",";
+  json += "\"hits\":" + String(status.poolHits) + ",";
+  json += "\"misses\":" + String(status.poolMisses);
+  json += "},";
+  json += "\"heap\":{";
+  json += "\"free\":" + String(status.freeHeap) + ",";
+  json += "\"minFree\":" + String(status.minFreeHeap) + ",";
+  json += "\"largestBlock\":" + String(status.largestFreeBlock) + ",";
+  json += "\"minLargestBlock\":" + String(status.minLargestFreeBlock) + ",";
+  json += "\"slab\":" + String(status.slabSize);
+  json += "},";
+  json += "\"logDropped\":" + String(status.logDropped) + ",";
+  json += "\"uptime\":" + String(millis() / 1000) + ",";
+  json += "\"ip\":\"" + ETH.localIP().toString() + "\",";
+  json += "\"connections\":[";
+
+  bool first = true;
+  for (int i = 0; i < status.capacity; i++) {
+    const SlotStatus& conn = status.slots[i];
+    if (conn.used) {
+      if (!first) json += ",";
+      first = false;
+
+      json += "{";
+      json += "\"slot\":" + String(i) + ",";
+      json += "\"id\":" + String(conn.id) + ",";
+      json += "\"cloudSocket\":" + String(conn.cloudSocket ? "true" : "false") + ",";
+      json += "\"deviceSocket\":" + String(conn.deviceSocket ? "true" : "false") + ",";
+      json += "\"cloudConnected\":" + String(conn.cloudConnected ? "true" : "false") + ",";
+      json += "\"deviceConnected\":" + String(conn.deviceConnected ? "true" : "false") + ",";
+      json += "\"deviceConnecting\":" + String(conn.deviceConnecting ? "true" : "false") + ",";
+      json += "\"cloudToDevice\":" + String(conn.cloudToDevice) + ",";
+      json += "\"deviceToCloud\":" + String(conn.deviceToCloud) + ",";
+      json += "\"toDevice\":" + trafficJSON(conn.toDevice) + ",";
+      json += "\"toCloud\":" + trafficJSON(conn.toCloud) + ",";
+      json += "\"age\":" + String(conn.ageMs) + ",";
+      json += "\"attached\":" + String(conn.attachedMs) + ",";
+      json += "\"idle\":" + String(conn.idleMs) + ",";
+      json += "\"status\":\"" + String(conn.free ? "FREE" : "ACTIVE") + "\"";
+      json += "}";
+    }
+  }
+
+  json += "]";
+  json += "}";
+  return json;
+}
+
+static void handleStatusString(WebServer& server) {
+  String json = generateStatusJSON();
+  server.send(200, "application/json", json);
+}
+
+//////////
+// Runs //
+//////////
+
+template <typename Request>
+static void measure(const char* name, WebServer& server, int requests, Request request) {
+  request();  // once before counting: lazy initialisation isn't part of a request
+
+  allocations = 0;
+  allocatedBytes = 0;
+  counting = true;
+  unsigned long start = micros();
+  for (int i = 0; i < requests; i++) {
+    server.responseBytes = 0;
+    server.responseChunks = 0;
+    request();
+  }
+  unsigned long elapsed = micros() - start;
+  counting = false;
+
+  printf("%-10s %8u %8u %12.1f %12.1f %10.2f\n", name, (unsigned)server.responseBytes, (unsigned)server.responseChunks,
+         (double)allocations / requests, (double)allocatedBytes / requests, (double)elapsed / requests);
+}
+
+int main(int argc, char** argv) {
+  int requests = (argc > 1) ? atoi(argv[1]) : 10000;
+
+  uint16_t cloudPort;
+  int cloudFd = listenLocal(cloudPort);
+  std::thread(cloudMain, cloudFd).detach();
+
+  ProxyConfig config;
+  memset(&config, 0, sizeof(config));
+  strncpy(config.cloudServer, "127.0.0.1", sizeof(config.cloudServer) - 1);
+  config.cloudPort = cloudPort;
+  config.routeCount = 1;
+  strncpy(config.routes[0].uniqueId, "bench:5001", sizeof(config.routes[0].uniqueId) - 1);
+  strncpy(config.routes[0].masterAddress, "127.0.0.1", sizeof(config.routes[0].masterAddress) - 1);
+  config.routes[0].masterPort = MASTER_PORT;
+  config.capacity = CONNECTION_CAPACITY;
+  config.bufferSize = FORWARD_BUFFER_SIZE;
+  config.poolMinFree = POOL_SIZE;
+  config.poolMaxFree = POOL_SIZE;
+  config.cloudSocket = { CLOUD_TCP_NODELAY, CLOUD_KEEPALIVE_IDLE, CLOUD_KEEPALIVE_INTERVAL, CLOUD_KEEPALIVE_COUNT, CLOUD_SEND_BUFFER };
+  config.deviceSocket = { DEVICE_TCP_NODELAY, DEVICE_KEEPALIVE_IDLE, DEVICE_KEEPALIVE_INTERVAL, DEVICE_KEEPALIVE_COUNT, DEVICE_SEND_BUFFER };
+
+  if (!proxy.begin(config) || !proxy.start()) {
+    fprintf(stderr, "[BENCH] Proxy did not start\n");
+    return 1;
+  }
+
+  // Wait for the pool to fill up: a slot entry per free connection
+  static ProxyStatus status;
+  unsigned long waitStart = millis();
+  while (millis() - waitStart < 5000) {
+    if (proxy.getStatus(status) && status.freeConnections >= POOL_SIZE) break;
+    delay(10);
+  }
+
+  WebConfig web(&proxy);
+  web.begin();
+  WebServer& server = *WebServer::last;
+
+  printf("/status benchmark: %d requests, %d connections in the status\n", requests, status.freeConnections);
+  printf("%-10s %8s %8s %12s %12s %10s\n", "", "bytes", "chunks", "allocs/req", "alloc B/req", "us/req");
+  measure("String", server, requests, [&]() { handleStatusString(server); });
+  measure("streamed", server, requests, [&]() { server.request(HTTP_GET, "/status"); });
+
+  // The proxy task never ends, don't wait for it
+  fflush(stdout);
+  _exit(0);
+}
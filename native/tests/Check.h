@@ -0,0 +1,22 @@
+/*
+ * Checks for the host unit tests
+ *
+ * No test framework: each test is a function that calls CHECK() on what it
+ * expects, main.cpp runs them all and exits with 1 if any check failed.
+ * A failed check prints where it is and goes on, so one run shows them all.
+ *
+ * Author: Johan Coppieters for Duotecno
+ * Date: November 2025
+ */
+
+#ifndef CHECK_H
+#define CHECK_H
+
+#include <Arduino.h>
+
+#define CHECK(condition) checkResult((condition), #condition, __FILE__, __LINE__)
+
+// Counts the check, prints it when it failed, returns ok
+bool checkResult(bool ok, const char* what, const char* file, int line);
+
+#endif // CHECK_H
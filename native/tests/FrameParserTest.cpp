@@ -0,0 +1,154 @@
+/*
+ * FrameParser on what the cloud sends a free connection, cut into reads in
+ * every way TCP may deliver it: frames merged into one read, split over
+ * several, and data that is not a control frame at all.
+ */
+
+#include "Check.h"
+#include "FrameParser.h"
+#include <string>
+#include <vector>
+
+// Frame types in the order the parser returned them, one letter each:
+// H(eartbeat), R(esponse), C(lient)
+struct Parsed {
+  std::string frames;
+  std::string client;  // Everything for the device after a C: prefix() + the rest
+};
+
+static Parsed parse(const std::vector<std::string>& reads) {
+  FrameParser parser;
+  Parsed parsed;
+  bool attached = false;
+  for (size_t r = 0; r < reads.size(); r++) {
+    const uint8_t* data = (const uint8_t*)reads[r].data();
+    size_t len = reads[r].size();
+    if (attached) {
+      parsed.client += reads[r];  // the proxy forwards the next reads as they are
+      continue;
+    }
+    size_t pos = 0;
+    FrameType type;
+    while (!attached && (type = parser.next(data, len, pos)) != FRAME_NONE) {
+      parsed.frames += (type == FRAME_HEARTBEAT) ? 'H' : (type == FRAME_RESPONSE) ? 'R' : 'C';
+      if (type == FRAME_CLIENT) {
+        attached = true;
+        parsed.client.assign(parser.prefix(), parser.prefixLength());
+        parsed.client.append((const char*)data + pos, len - pos);
+      }
+    }
+  }
+  return parsed;
+}
+
+// Every way to cut text into two reads gives the same result as one read
+static bool sameWhenSplit(const std::string& text) {
+  Parsed whole = parse({ text });
+  for (size_t cut = 0; cut <= text.size(); cut++) {
+    Parsed split = parse({ text.substr(0, cut), text.substr(cut) });
+    if (split.frames != whole.frames || split.client != whole.client) return false;
+  }
+  return true;
+}
+
+static void testHeartbeats() {
+  CHECK(parse({ "[215,3]" }).frames == "H");
+  CHECK(parse({ "[215,3][215,3]" }).frames == "HH");
+  CHECK(parse({ "[215,3][215,3][215,3]" }).frames == "HHH");
+  CHECK(parse({ "[215", ",3]" }).frames == "H");
+  CHECK(parse({ "[", "2", "1", "5", ",", "3", "]" }).frames == "H");
+  CHECK(parse({ "[215,3][21", "5,3]" }).frames == "HH");
+  CHECK(parse({ "", "[215,3]", "" }).frames == "H");
+  CHECK(parse({ "[215,3]\r\n[215,3]\r\n" }).frames == "HH");
+  CHECK(sameWhenSplit("[215,3][215,3]"));
+  CHECK(sameWhenSplit("[215,3]\r\n[215,3]"));
+}
+
+static void testResponses() {
+  CHECK(parse({ "[OK]" }).frames == "R");
+  CHECK(parse({ "[OK,registered]" }).frames == "R");
+  CHECK(parse({ "[ERROR,unknown id]" }).frames == "R");
+  CHECK(parse({ "[O", "K]" }).frames == "R");
+  CHECK(parse({ "[ERR", "OR,", "a long reason", "]" }).frames == "R");
+  CHECK(parse({ "[ERROR,unknown id" }).frames == "");  // not finished yet
+  CHECK(parse({ "[OK][215,3]" }).frames == "RH");
+  CHECK(parse({ "[OK,x]\r\n[215", ",3]" }).frames == "RH");
+  CHECK(sameWhenSplit("[OK,registered][215,3]"));
+  CHECK(sameWhenSplit("[ERROR,unknown id]\r\n[215,3]"));
+
+  // The response text isn't kept, only its start
+  FrameParser parser;
+  size_t pos = 0;
+  const char* text = "[OK,registered]";
+  CHECK(parser.next((const uint8_t*)text, strlen(text), pos) == FRAME_RESPONSE);
+  CHECK(pos == strlen(text));
+  CHECK(strcmp(parser.prefix(), "[OK") == 0);
+}
+
+static void testClientData() {
+  // Not a frame: all of it is for the device
+  Parsed parsed = parse({ "GET / HTTP/1.1" });
+  CHECK(parsed.frames == "C");
+  CHECK(parsed.client == "GET / HTTP/1.1");
+
+  // Frames that only look like control frames for a while: their start is kept
+  parsed = parse({ "[215,30]" });
+  CHECK(parsed.frames == "C" && parsed.client == "[215,30]");
+  parsed = parse({ "[2", "15,", "4,1]" });
+  CHECK(parsed.frames == "C" && parsed.client == "[215,4,1]");
+  parsed = parse({ "[O", "N]" });
+  CHECK(parsed.frames == "C" && parsed.client == "[ON]");
+  parsed = parse({ "[52,1,2]" });
+  CHECK(parsed.frames == "C" && parsed.client == "[52,1,2]");
+
+  // After control frames, in the same read or the next ones
+  parsed = parse({ "[215,3][52,1]", "[52,2]" });
+  CHECK(parsed.frames == "HC" && parsed.client == "[52,1][52,2]");
+  parsed = parse({ "[OK][215,3]", "[215,4]" });
+  CHECK(parsed.frames == "RHC" && parsed.client == "[215,4]");
+  CHECK(sameWhenSplit("[215,3][215,30]"));
+  CHECK(sameWhenSplit("[OK,x][215,3][52,1,2,3]"));
+
+  // Spaces and line ends are only skipped after a control frame, not lost from a client
+  parsed = parse({ "\r\n[52,1]" });
+  CHECK(parsed.frames == "C" && parsed.client == "\r\n[52,1]");
+  parsed = parse({ " x" });
+  CHECK(parsed.frames == "C" && parsed.client == " x");
+
+  // Binary data, zero bytes included
+  std::string binary("\x00\x01[215,3]", 9);
+  parsed = parse({ binary });
+  CHECK(parsed.frames == "C" && parsed.client == binary);
+
+  // reset() forgets a frame that was half read
+  FrameParser parser;
+  size_t pos = 0;
+  CHECK(parser.next((const uint8_t*)"[21", 3, pos) == FRAME_NONE);
+  parser.reset();
+  pos = 0;
+  CHECK(parser.next((const uint8_t*)"5,3]", 4, pos) == FRAME_CLIENT);
+  CHECK(pos == 0 && parser.prefixLength() == 0);
+}
+
+static void testFindByte() {
+  // Every position in and around the 4 byte words, and not found at all
+  for (size_t len = 0; len < 20; len++) {
+    std::string text(len, 'x');
+    CHECK(FrameParser::findByte((const uint8_t*)text.data(), len, ']') == len);
+    for (size_t at = 0; at < len; at++) {
+      text[at] = ']';
+      CHECK(FrameParser::findByte((const uint8_t*)text.data(), len, ']') == at);
+      text[at] = 'x';
+    }
+  }
+  // The first one wins, other bytes of the word don't count
+  CHECK(FrameParser::findByte((const uint8_t*)"ab]]", 4, ']') == 2);
+  CHECK(FrameParser::findByte((const uint8_t*)"\xdd\x5c\x5e]", 4, ']') == 3);
+}
+
+void testFrameParser() {
+  testHeartbeats();
+  testResponses();
+  testClientData();
+  testFindByte();
+}
@@ -0,0 +1,171 @@
+/*
+ * SocketSet and the non-blocking socket helpers, on loopback connections:
+ * readable when data or a close is waiting, writable when the send buffer
+ * has room, and writable once a connect finished (or failed). Sending to a
+ * peer that reset the connection is an error, not a SIGPIPE.
+ */
+
+#include "Check.h"
+#include "SocketUtil.h"
+#include <arpa/inet.h>
+
+static const SocketProfile PROFILE = { true, 0, 0, 0, 0 };
+static const SocketProfile SMALL_SEND_BUFFER = { true, 0, 0, 0, 4096 };
+
+// Listening socket on 127.0.0.1, on a port the system picks
+static int listenLocal(uint16_t& port) {
+  int fd = socket(AF_INET, SOCK_STREAM, 0);
+  struct sockaddr_in addr;
+  memset(&addr, 0, sizeof(addr));
+  addr.sin_family = AF_INET;
+  addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  bind(fd, (struct sockaddr*)&addr, sizeof(addr));
+  listen(fd, 4);
+  socklen_t len = sizeof(addr);
+  getsockname(fd, (struct sockaddr*)&addr, &len);
+  port = ntohs(addr.sin_port);
+  return fd;
+}
+
+// Wait until fd is writable (connect done), false after timeoutMs
+static bool waitWritable(int fd, unsigned long timeoutMs) {
+  SocketSet io;
+  io.watchWrite(fd);
+  return io.wait(timeoutMs) > 0 && io.canWrite(fd);
+}
+
+static void testConnect(int listenFd, uint16_t port, int& client, int& server) {
+  client = socketConnectStart(IPAddress(127, 0, 0, 1), port, PROFILE);
+  CHECK(client >= 0);
+  CHECK(waitWritable(client, 1000));
+  CHECK(socketConnectCheck(client) == 1);
+  server = accept(listenFd, nullptr, nullptr);
+  CHECK(server >= 0);
+}
+
+static void testConnectRefused() {
+  // A port nobody listens on anymore
+  uint16_t port;
+  int closedFd = listenLocal(port);
+  close(closedFd);
+
+  int fd = socketConnectStart(IPAddress(127, 0, 0, 1), port, PROFILE);
+  if (fd < 0) return;  // refused right away, also fine
+  CHECK(waitWritable(fd, 1000));
+  CHECK(socketConnectCheck(fd) == -1);
+  socketClose(fd);
+}
+
+static void testRead(int client, int server) {
+  SocketSet io;
+  uint8_t data[16];
+
+  // Nothing sent: times out, after about the time asked for
+  io.watchRead(client);
+  unsigned long start = millis();
+  CHECK(io.wait(50) == 0);
+  CHECK(millis() - start >= 40);
+  CHECK(!io.canRead(client));
+  CHECK(socketRecv(client, data, sizeof(data)) == 0);
+
+  // Data waiting
+  CHECK(send(server, "ping", 4, 0) == 4);
+  CHECK(io.wait(1000) == 1);
+  CHECK(io.canRead(client));
+  CHECK(!io.canWrite(client));  // only watched for reading
+  CHECK(socketRecv(client, data, sizeof(data)) == 4);
+  CHECK(memcmp(data, "ping", 4) == 0);
+
+  // Read into the two halves of a wrapped ring
+  CHECK(send(server, "abcdef", 6, 0) == 6);
+  CHECK(io.wait(1000) == 1);
+  CHECK(socketRecv(client, data, 4, data + 8, 8) == 6);
+  CHECK(memcmp(data, "abcd", 4) == 0 && memcmp(data + 8, "ef", 2) == 0);
+
+  // clear() forgets what was watched and what was ready
+  io.clear();
+  CHECK(!io.canRead(client));
+  CHECK(!io.canRead(-1));
+}
+
+static void testWrite(int client, int server) {
+  socketApplyProfile(client, SMALL_SEND_BUFFER);
+  int small = 4096;
+  setsockopt(server, SOL_SOCKET, SO_RCVBUF, &small, sizeof(small));
+
+  SocketSet io;
+  io.watchWrite(client);
+  CHECK(io.wait(1000) == 1);
+  CHECK(io.canWrite(client));
+
+  // Peer doesn't read: fill everything up until send takes nothing
+  static uint8_t block[4096];
+  size_t queued = 0;
+  int sent;
+  while ((sent = socketSend(client, block, sizeof(block))) > 0 && queued < 64 * 1024 * 1024) queued += sent;
+  CHECK(sent == 0);
+  CHECK(io.wait(50) == 0);
+  CHECK(!io.canWrite(client));
+
+  // Peer reads it all: writable again
+  uint8_t buffer[4096];
+  bool writable = false;
+  while (!writable && queued > 0) {
+    int got = recv(server, buffer, sizeof(buffer), MSG_DONTWAIT);
+    if (got > 0) queued -= got;
+    writable = io.wait(got > 0 ? 0 : 10) > 0 && io.canWrite(client);
+  }
+  CHECK(writable);
+
+  // Two pieces in one send
+  CHECK(socketSend(client, (const uint8_t*)"wr", 2, (const uint8_t*)"ap", 2) == 4);
+}
+
+static void testClose(int client, int server) {
+  // A close by the peer is readable, and reads as -1
+  close(server);
+  SocketSet io;
+  io.watchRead(client);
+  CHECK(io.wait(1000) == 1);
+  CHECK(io.canRead(client));
+
+  uint8_t data[4096];
+  int got;
+  while ((got = socketRecv(client, data, sizeof(data))) > 0) {}
+  CHECK(got == -1);
+  socketClose(client);
+}
+
+static void testSendAfterReset(int listenFd, uint16_t port) {
+  // The peer resets the connection: sending fails with -1 (no SIGPIPE ending the program)
+  int client, server;
+  testConnect(listenFd, port, client, server);
+  struct linger reset = { 1, 0 };
+  setsockopt(server, SOL_SOCKET, SO_LINGER, &reset, sizeof(reset));
+  close(server);
+
+  int sent = 0;
+  for (int i = 0; i < 100 && sent >= 0; i++) {
+    sent = socketSend(client, (const uint8_t*)"data", 4);
+    if (sent >= 0) delay(1);
+  }
+  CHECK(sent == -1);
+  CHECK(socketSend(client, (const uint8_t*)"da", 2, (const uint8_t*)"ta", 2) == -1);
+  socketClose(client);
+}
+
+void testSocketSet() {
+  uint16_t port;
+  int listenFd = listenLocal(port);
+
+  int client, server;
+  testConnect(listenFd, port, client, server);
+  testConnectRefused();
+  if (client >= 0 && server >= 0) {
+    testRead(client, server);
+    testWrite(client, server);
+    testClose(client, server);
+  }
+  testSendAfterReset(listenFd, port);
+  close(listenFd);
+}
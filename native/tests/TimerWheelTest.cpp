@@ -0,0 +1,105 @@
+/*
+ * TimerWheel against a brute force list of deadlines, on random schedules,
+ * cancels and clock steps: short steps, steps of a few ticks, and stalls of
+ * more than a turn of the wheel. After every step:
+ *  - nothing expires before its deadline
+ *  - nothing expires more than one tick late
+ *  - msUntilNext() is never later than the next deadline (+ one tick)
+ */
+
+#include "Check.h"
+#include "TimerWheel.h"
+
+static const int SLOTS = MAX_CONNECTIONS;
+static const unsigned long TURN = TimerWheel::BUCKETS * TIMER_WHEEL_TICK;
+
+// Same sequence on every run
+static uint32_t nextRandom(uint32_t& state) {
+  state ^= state << 13;
+  state ^= state >> 17;
+  state ^= state << 5;
+  return state;
+}
+
+static void runRandom(uint32_t seed, int steps) {
+  static TimerWheel wheel;  // too big to be put on the stack for every run
+  bool scheduled[SLOTS];
+  unsigned long deadlines[SLOTS];
+
+  unsigned long now = 1000;
+  wheel.clear(now);
+  for (int s = 0; s < SLOTS; s++) scheduled[s] = false;
+
+  int early = 0, late = 0, lost = 0, wrongNext = 0;
+  uint32_t state = seed;
+  for (int step = 0; step < steps; step++) {
+    // A few schedules and cancels, deadlines up to more than two turns away
+    int changes = nextRandom(state) % 4;
+    for (int c = 0; c < changes; c++) {
+      int slot = nextRandom(state) % SLOTS;
+      if (nextRandom(state) % 5 == 0) {
+        wheel.cancel(slot);
+        scheduled[slot] = false;
+      } else {
+        unsigned long deadline = now + nextRandom(state) % (2 * TURN + TURN / 2);
+        wheel.schedule(slot, deadline);
+        scheduled[slot] = true;
+        deadlines[slot] = deadline;
+      }
+    }
+
+    // msUntilNext() may be early, never later than the first deadline's tick
+    unsigned long next = wheel.msUntilNext(now);
+    unsigned long first = NO_TIMER;
+    for (int s = 0; s < SLOTS; s++) {
+      if (scheduled[s]) first = min(first, deadlines[s] > now ? deadlines[s] - now : 0UL);
+    }
+    if (first == NO_TIMER ? next != NO_TIMER : next == NO_TIMER || next >= first + TIMER_WHEEL_TICK) wrongNext++;
+
+    // Mostly short steps, now and then a loop that stalled for more than a turn
+    uint32_t kind = nextRandom(state) % 20;
+    if (kind == 0) now += TURN + nextRandom(state) % (2 * TURN);
+    else if (kind < 5) now += nextRandom(state) % (8 * TIMER_WHEEL_TICK);
+    else now += nextRandom(state) % TIMER_WHEEL_TICK;
+
+    SlotSet expired = wheel.expire(now);
+    for (int s = 0; s < SLOTS; s++) {
+      if (expired.contains(s)) {
+        if (!scheduled[s] || (long)(now - deadlines[s]) < 0) early++;
+        scheduled[s] = false;
+      } else if (scheduled[s] && (long)(now - deadlines[s]) >= (long)TIMER_WHEEL_TICK) {
+        late++;
+      }
+      if (wheel.isScheduled(s) != scheduled[s]) lost++;
+    }
+  }
+
+  CHECK(early == 0);
+  CHECK(late == 0);
+  CHECK(lost == 0);
+  CHECK(wrongNext == 0);
+}
+
+static void testStall() {
+  // The loop sleeps for more than a turn (and not a whole number of turns),
+  // a deadline set before it is due 1 s after it woke up
+  static TimerWheel wheel;
+  unsigned long now = 0;
+  unsigned long wake = 2 * TURN + 10 * TIMER_WHEEL_TICK;
+  wheel.clear(now);
+  wheel.schedule(1, wake + 1000);
+
+  now = wake;
+  CHECK(wheel.expire(now).isEmpty());
+  CHECK(wheel.msUntilNext(now) <= 1000);
+
+  now += 1000;
+  CHECK(wheel.expire(now).contains(1));
+  CHECK(!wheel.isScheduled(1));
+  CHECK(wheel.msUntilNext(now) == NO_TIMER);
+}
+
+void testTimerWheel() {
+  testStall();
+  for (uint32_t seed = 1; seed <= 20; seed++) runRandom(seed * 2654435761UL, 5000);
+}
@@ -0,0 +1,49 @@
+/*
+ * Unit tests of the proxy core, on the host
+ *
+ *   pio run -e native_tests && .pio/build/native_tests/program
+ *
+ * Prints one line per test, exits with 1 if a check failed.
+ *
+ * Author: Johan Coppieters for Duotecno
+ * Date: November 2025
+ */
+
+#include "Check.h"
+
+void testSocketSet();
+void testFrameParser();
+void testTimerWheel();
+
+struct Test {
+  const char* name;
+  void (*run)();
+};
+
+static const Test TESTS[] = {
+  { "SocketSet", testSocketSet },
+  { "FrameParser", testFrameParser },
+  { "TimerWheel", testTimerWheel },
+};
+
+static int checks = 0;
+static int failures = 0;
+
+bool checkResult(bool ok, const char* what, const char* file, int line) {
+  checks++;
+  if (!ok) {
+    failures++;
+    printf("  %s:%d: CHECK(%s) failed\n", file, line, what);
+  }
+  return ok;
+}
+
+int main() {
+  for (size_t i = 0; i < sizeof(TESTS) / sizeof(TESTS[0]); i++) {
+    int failuresBefore = failures;
+    TESTS[i].run();
+    printf("[TEST] %-12s %s\n", TESTS[i].name, (failures == failuresBefore) ? "ok" : "FAILED");
+  }
+  printf("[TEST] %d checks, %d failed\n", checks, failures);
+  return failures ? 1 : 0;
+}
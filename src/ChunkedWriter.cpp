@@ -0,0 +1,55 @@
+#include "ChunkedWriter.h"
+#include <stdarg.h>
+
+void ChunkedWriter::begin(const char* contentType) {
+  this->len = 0;
+  this->server->setContentLength(CONTENT_LENGTH_UNKNOWN);
+  this->server->send(200, contentType, "");
+}
+
+void ChunkedWriter::end() {
+  this->flush();
+  this->server->sendContent("", 0);  // last chunk
+}
+
+void ChunkedWriter::flush() {
+  if (this->len == 0) return;
+  this->server->sendContent(this->buffer, this->len);
+  this->len = 0;
+}
+
+void ChunkedWriter::print(const char* text) {
+  while (*text) {
+    if (this->len == sizeof(this->buffer)) this->flush();
+    size_t room = sizeof(this->buffer) - this->len;
+    size_t n = strnlen(text, room);
+    memcpy(this->buffer + this->len, text, n);
+    this->len += n;
+    text += n;
+  }
+}
+
+void ChunkedWriter::print(char c) {
+  if (this->len == sizeof(this->buffer)) this->flush();
+  this->buffer[this->len++] = c;
+}
+
+void ChunkedWriter::print(uint64_t value) {
+  char digits[21];
+  int i = sizeof(digits) - 1;
+  digits[i] = '\0';
+  do {
+    digits[--i] = '0' + (value % 10);
+    value /= 10;
+  } while (value > 0);
+  this->print(digits + i);
+}
+
+void ChunkedWriter::printf(const char* format, ...) {
+  char text[128];
+  va_list args;
+  va_start(args, format);
+  vsnprintf(text, sizeof(text), format, args);
+  va_end(args);
+  this->print(text);
+}
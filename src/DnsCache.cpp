@@ -0,0 +1,110 @@
+#include "DnsCache.h"
+#include <lwip/tcpip.h>
+
+DnsCache::DnsCache() {
+  this->hits = 0;
+  this->misses = 0;
+  this->stale = 0;
+  this->lookups = 0;
+  this->failures = 0;
+  this->begin("");
+}
+
+void DnsCache::begin(const char* hostname) {
+  this->hostname = hostname;
+  this->valid = false;
+  this->expired = false;
+  this->resolvedAt = 0;
+  this->resolving = false;
+  this->lookupStart = 0;
+  this->result.done = false;
+  this->result.address = 0;
+}
+
+bool DnsCache::lookup(IPAddress& address, unsigned long now) {
+  if (this->valid && !this->expired && now - this->resolvedAt < DNS_CACHE_TTL) {
+    this->hits++;
+    address = this->address;
+    return true;
+  }
+
+  if (this->valid) {
+    // Too old, but better than nothing: use it and look for a new one meanwhile
+    this->stale++;
+    if (!this->resolving) this->startLookup(now);
+    address = this->address;
+    return true;
+  }
+
+  // Never resolved: the caller waits for the lookup (an answer from lwIP's table may be immediate)
+  this->misses++;
+  if (!this->resolving) this->startLookup(now);
+  if (!this->valid) return false;
+  address = this->address;
+  return true;
+}
+
+void DnsCache::loop(unsigned long now) {
+  if (this->resolving) {
+    if (this->result.done) {
+      this->resolving = false;
+      if (this->result.address != 0) {
+        this->resolved(this->result.address, now);
+      } else {
+        this->failed();
+      }
+    } else if (now - this->lookupStart >= CLOUD_DNS_TIMEOUT) {
+      // A late answer only sets result.done, the next lookup clears it again
+      this->resolving = false;
+      this->failed();
+    }
+    return;
+  }
+
+  // Refresh in the background before the address expires, and retry
+  // (not too often) while lookups fail and we live on the last known good one
+  if (this->valid && (this->expired || now - this->resolvedAt >= DNS_CACHE_REFRESH)
+      && now - this->lookupStart >= DNS_CACHE_RETRY) {
+    this->startLookup(now);
+  }
+}
+
+// DNS callback - runs on the lwIP thread, only hands over the answer
+void DnsCache::dnsFound(const char* /* name */, const ip_addr_t* ipaddr, void* arg) {
+  Result* result = (Result*)arg;
+  result->address = ipaddr ? ipaddr->u_addr.ip4.addr : 0;
+  result->done = true;
+}
+
+void DnsCache::startLookup(unsigned long now) {
+  this->lookups++;
+  this->lookupStart = now;
+  this->result.done = false;
+  this->result.address = 0;
+
+  // lwIP answers immediately if it still has the name in its own table
+  ip_addr_t addr;
+  LOCK_TCPIP_CORE();
+  err_t err = dns_gethostbyname(this->hostname, &addr, DnsCache::dnsFound, &this->result);
+  UNLOCK_TCPIP_CORE();
+
+  if (err == ERR_OK) {
+    this->resolved(addr.u_addr.ip4.addr, now);
+  } else if (err == ERR_INPROGRESS) {
+    this->resolving = true;
+  } else {
+    this->failed();
+  }
+}
+
+void DnsCache::resolved(uint32_t address, unsigned long now) {
+  this->address = IPAddress(address);
+  this->valid = true;
+  this->expired = false;
+  this->resolvedAt = now;
+}
+
+void DnsCache::failed() {
+  // Keep whatever address we have, it is still the best guess
+  this->failures++;
+}
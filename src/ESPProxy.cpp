@@ -1,5 +1,11 @@
 #include "ESPProxy.h"
+#include "SocketUtil.h"
+#include "TaskUtil.h"
+#include "MemoryUtil.h"
 #include "config.h"
+#include <new>
+#include <lwip/dns.h>
+#include <lwip/tcpip.h>
 
 ////////////////////////////
 // Context Implementation //
@@ -8,214 +14,515 @@
 // A Context is a single cloud-to-device connection pair.
 // It manages the two sockets and data forwarding between them.
 //
-Context::Context(WiFiClient* cloudSocket, ESPProxy* proxy, int connectionId) {
+Context::Context() {
+  // Slab entry, stays empty until open()
+  this->proxy = nullptr;
+  this->connectionId = 0;
+  this->slot = -1;
+  this->route = 0;
+  this->toDevice.clear();
+  this->toCloud.clear();
+  this->createdAt = 0;
+  this->deviceAttachedAt = 0;
+  this->lastActivity = 0;
+  this->cloudFd = -1;
+  this->deviceFd = -1;
+  this->deviceConnectStart = 0;
+  this->cloudConnected = false;
+  this->deviceConnected = false;
+  this->warmFd = -1;
+  this->warmConnected = false;
+  this->warmConnectStart = 0;
+  this->clientStart = 0;
+  this->ttfbPending = false;
+  this->ttfbWarm = false;
+  
+  this->ledOnTime = 0;
+  this->ledState = false;
+}
+
+Context::~Context() {
+  this->cleanupSockets();
+}
+
+void Context::attachBuffers(uint8_t* storage, size_t bufferSize) {
+  this->cloudToDevice.begin(storage, bufferSize);
+  this->deviceToCloud.begin(storage + bufferSize, bufferSize);
+}
+
+void Context::open(int slot, int cloudFd, ESPProxy* proxy, int connectionId, int route) {
   // We receive 
-  //  a socket already connected to the cloud server
+  //  our slot in the slab
+  //  a socket already connected to the cloud server (and registered)
   //  a reference to the parent ESPProxy instance
   //  a connection identifier for debugging (global number incremented by ESPProxy)
-  this->cloudSocket = cloudSocket;
+  //  the route it was registered for, which tells us the master to connect to
+  this->slot = slot;
+  this->cloudFd = cloudFd;
   this->proxy = proxy;
   this->connectionId = connectionId;
+  this->route = route;
 
-  // initialize members
-  this->deviceSocket = nullptr;
+  // initialize members, nothing is left over from the previous connection in this slot
+  this->deviceFd = -1;
+  this->deviceConnectStart = 0;
   
-  this->cloudConnected = (this->cloudSocket && this->cloudSocket->connected());
+  this->cloudConnected = (this->cloudFd >= 0);
   this->deviceConnected = false;
+  this->warmFd = -1;
+  this->warmConnected = false;
+  this->ttfbPending = false;
+  this->ttfbWarm = false;
+  
+  this->cloudToDevice.clear();
+  this->deviceToCloud.clear();
+  this->toDeviceLatency.clear();
+  this->toCloudLatency.clear();
+  this->cloudFrames.reset();
+  
+  this->toDevice.clear();
+  this->toCloud.clear();
+  this->createdAt = millis();
+  this->deviceAttachedAt = 0;
+  this->lastActivity = this->createdAt;
   
   this->ledOnTime = 0;
   this->ledState = false;
 }
 
-Context::~Context() {
-  this->cleanupSockets();
-}
-
 void Context::cleanupSockets() {
-  if (this->deviceSocket) {
-    if (this->deviceSocket->connected()) {
-      this->deviceSocket->stop();
-    }
-    delete this->deviceSocket;
-    this->deviceSocket = nullptr;
+  // Device connection, connected or still being set up
+  if (this->deviceFd >= 0) {
+    socketClose(this->deviceFd);
+    this->deviceFd = -1;
     this->deviceConnected = false;
   }
+  this->closeWarmSocket();
   
-  if (this->cloudSocket) {
-    if (this->cloudSocket->connected()) {
-      this->cloudSocket->stop();
-    }
-    delete this->cloudSocket;
-    this->cloudSocket = nullptr;
+  if (this->cloudFd >= 0) {
+    socketClose(this->cloudFd);
+    this->cloudFd = -1;
     this->cloudConnected = false;
   }
+  
+  this->cloudToDevice.clear();
+  this->deviceToCloud.clear();
+  this->toDeviceLatency.clear();
+  this->toCloudLatency.clear();
+  
+  if (this->proxy) this->proxy->slotChanged(this->slot);  // no longer free
+}
+
+void Context::watch(SocketSet& io) const {
+  // Read a side only while we have room to queue its data,
+  // wait for writable only while something is queued for it
+  if (this->cloudFd >= 0) {
+    if (!this->cloudToDevice.isFull()) io.watchRead(this->cloudFd);
+    if (!this->deviceToCloud.isEmpty()) io.watchWrite(this->cloudFd);
+  }
+  
+  if (this->deviceConnected) {
+    if (!this->deviceToCloud.isFull()) io.watchRead(this->deviceFd);
+    if (!this->cloudToDevice.isEmpty()) io.watchWrite(this->deviceFd);
+  } else if (this->deviceFd >= 0) {
+    io.watchWrite(this->deviceFd);  // becomes writable when the connect finishes
+  }
+  
+  // Pre-connected master socket: nothing is sent on it until a client arrives,
+  // once connected it only becomes readable if the master closes it
+  if (this->warmFd >= 0) {
+    if (this->warmConnected) {
+      io.watchRead(this->warmFd);
+    } else {
+      io.watchWrite(this->warmFd);
+    }
+  }
 }
 
-void Context::loop() {
+bool Context::isReady(const SocketSet& io) const {
+  if (io.canRead(this->cloudFd) || io.canWrite(this->cloudFd)) return true;
+  if (io.canRead(this->warmFd) || io.canWrite(this->warmFd)) return true;
+  return io.canRead(this->deviceFd) || io.canWrite(this->deviceFd);
+}
+
+unsigned long Context::msUntilTimer(unsigned long now) const {
+  unsigned long wait = NO_TIMER;
+  
+  if (this->isDeviceConnecting()) {
+    unsigned long elapsed = now - this->deviceConnectStart;
+    wait = (elapsed >= DEVICE_CONNECT_TIMEOUT) ? 0 : DEVICE_CONNECT_TIMEOUT - elapsed;
+  }
+  if (this->warmFd >= 0 && !this->warmConnected) {
+    unsigned long elapsed = now - this->warmConnectStart;
+    wait = min(wait, (elapsed >= DEVICE_CONNECT_TIMEOUT) ? 0 : DEVICE_CONNECT_TIMEOUT - elapsed);
+  }
+  unsigned long timeout = this->idleTimeout();
+  if (timeout > 0) {
+    unsigned long elapsed = now - this->lastActivity;
+    wait = min(wait, (elapsed >= timeout) ? 0 : timeout - elapsed);
+  }
+  
+  #if ENABLE_LED
+    if (this->ledState) {
+      unsigned long elapsed = now - this->ledOnTime;
+      wait = min(wait, (elapsed >= LED_BLINK_DURATION) ? 0 : LED_BLINK_DURATION - elapsed);
+    }
+  #endif
+  
+  return wait;
+}
+
+void Context::loop(const SocketSet& io) {
   // Update LED state
   this->updateLED();
   
-  // Check cloud socket status
-  if (this->cloudSocket) {
-    if (!this->cloudSocket->connected()) {
-      Serial.println("[CLOUD] Connection closed");
+  // Pre-connect to the master finished, timed out or closed (before a client can take it)
+  if (this->hasWarmSocket()) {
+    this->checkWarmConnection(io);
+  }
+  
+  // Handle incoming data from cloud (only watched while we have room to queue it)
+  if (io.canRead(this->cloudFd)) {
+    if (!this->handleDataFromCloud()) {
+      this->proxy->logMessage(FROM_CLOUD, this->connectionId, "Connection closed");
       this->proxy->removeConnection(this);
       return;
     }
-    
-    // Handle incoming data from cloud
-    if (this->cloudSocket->available() > 0) {
-      this->handleDataFromCloud();
-    }
+  }
+  
+  // Device connection being set up - see if it is done (or timed out)
+  if (this->isDeviceConnecting()) {
+    this->checkDeviceConnection();
   }
   
   // Handle data from device to cloud
-  if (this->deviceSocket && this->deviceConnected) {
-
-    if (!this->deviceSocket->connected()) {
+  if (this->deviceConnected) {
+    
+    if (io.canRead(this->deviceFd) && !this->handleDataFromDevice()) {
       // Device disconnected - close entire connection (both device and cloud)
-      Serial.println("[DEVICE] Connection closed - removing entire connection");
+      // after passing on what it sent last
+      this->flushBuffer(DEVICE_TO_CLOUD);
+      this->proxy->logMessage(DEVICE_TO_CLOUD, this->connectionId, "Device closed the connection - removing entire connection");
       this->proxy->removeConnection(this);
       return;
     }
     
-    if (this->deviceSocket->available() > 0) {
-      // We have incoming data from device
-      uint8_t buffer[512];
-      int len = this->deviceSocket->read(buffer, sizeof(buffer));
-
-      if (len > 0) {
-        // Blink LED when forwarding device data to cloud
-        this->blinkLED();
-        this->proxy->logData(DEVICE_TO_CLOUD, len, buffer, this->connectionId);
+    if (!this->flushBuffer(CLOUD_TO_DEVICE)) {
+      this->proxy->logMessage(TO_DEVICE, this->connectionId, "Send failed - closing connection");
+      this->cleanupSockets();
+    }
+  }
+  
+  if (this->cloudFd >= 0 && !this->flushBuffer(DEVICE_TO_CLOUD)) {
+    this->proxy->logMessage(TO_CLOUD, this->connectionId, "Send failed - closing connection");
+    this->cleanupSockets();
+  }
+  
+  // Nothing heard for too long: the peer is gone without closing the connection
+  unsigned long timeout = this->idleTimeout();
+  if (timeout > 0 && millis() - this->lastActivity >= timeout) {
+    if (this->isFree()) {
+      this->proxy->logMessage(FROM_CLOUD, this->connectionId, "No heartbeat from the cloud - replacing free connection");
+      this->proxy->connectionTimedOut(TIMEOUT_HEARTBEAT);
+    } else {
+      this->proxy->logMessage(CLOUD_TO_DEVICE, this->connectionId, "No data from client or device - closing connection");
+      this->proxy->connectionTimedOut(TIMEOUT_IDLE);
+    }
+    this->proxy->removeConnection(this);
+    return;
+  }
+  
+  // Sockets are closed on errors or when the device could not be reached
+  if (!this->isActive()) {
+    this->proxy->removeConnection(this);
+  }
+}
+
+bool Context::handleDataFromCloud() {
+  // A client is attached: queue for the device (sent as soon as it is connected)
+  if (this->deviceFd >= 0) {
+    return this->receiveData(CLOUD_TO_DEVICE);
+  }
+  
+  // Leave room for the frame start the parser holds: it is queued in front of this read
+  uint8_t buffer[512];
+  size_t room = this->cloudToDevice.space();
+  if (room <= FRAME_PREFIX_SIZE) return true;
+  int len = socketRecv(this->cloudFd, buffer, min(sizeof(buffer), room - FRAME_PREFIX_SIZE));
+  
+  if (len < 0) return false;  // connection closed
+  if (len == 0) return true;
+  
+  this->lastActivity = millis();
+  this->blinkLED();  // Blink LED when receiving data from cloud
+  
+  // No device connection yet - see what the cloud sends, frame by frame
+  // (a read can hold several frames, or only part of one)
+  size_t pos = 0;
+  for (;;) {
+    switch (this->cloudFrames.next(buffer, len, pos)) {
+      case FRAME_NONE:
+        return true;
+      
+      case FRAME_HEARTBEAT:
+        this->proxy->logMessage(FROM_CLOUD, this->connectionId, "Heartbeat request, responding...");
+        // answer the heartbeat request, whole or not at all
+        if (this->deviceToCloud.space() < 6) {
+          this->proxy->logMessage(TO_CLOUD, this->connectionId, "No room to answer the heartbeat - closing connection");
+          return false;
+        }
+        this->deviceToCloud.write((const uint8_t*)"[72,3]", 6);
+        this->toCloudLatency.queuedUntimed(6);
+        break;
+      
+      case FRAME_RESPONSE:
+        // response from the server to our connection request
+        this->proxy->logMessage(FROM_CLOUD, this->connectionId, "Connection response: ", this->cloudFrames.prefix());
+        break;
+      
+      case FRAME_CLIENT:
+        // Real data - a new client wants to connect
+        //  -> we need to connect to the device 
+        //     and forward this data + all next data
+        this->proxy->logMessage(FROM_CLOUD, this->connectionId, "New client connection detected");
+        this->clientStart = micros();
+        this->ttfbPending = true;
         
-        if (this->cloudSocket && this->cloudSocket->connected()) {
-          this->cloudSocket->write(buffer, len);
+        // Start connecting to the device, the data is sent once connected:
+        // the start of the frame the parser kept, then the rest of this read
+        this->makeDeviceConnection((const uint8_t*)this->cloudFrames.prefix(), this->cloudFrames.prefixLength());
+        if (this->deviceFd >= 0) {
+          if (pos < (size_t)len) {
+            this->proxy->logData(CLOUD_TO_DEVICE, len - pos, buffer + pos, this->connectionId);
+            this->cloudToDevice.write(buffer + pos, len - pos);
+          }
           // Track statistics
-          this->proxy->addBytesTransferred(len);
+          this->countTraffic(CLOUD_TO_DEVICE, this->cloudFrames.prefixLength() + len - pos);
         }
-      }
+        
+        // This connection is now taken by a client: statistics + refill the pool right away
+        this->proxy->clientAttached(this->route);
+        return true;
     }
   }
 }
 
-void Context::handleDataFromCloud() {
-  uint8_t buffer[512];
-  int len = this->cloudSocket->read(buffer, sizeof(buffer));
+bool Context::handleDataFromDevice() {
+  return this->receiveData(DEVICE_TO_CLOUD);
+}
+
+bool Context::receiveData(ConnectionDirection direction) {
+  bool toDevice = (direction == CLOUD_TO_DEVICE);
+  RingBuffer& buffer = toDevice ? this->cloudToDevice : this->deviceToCloud;
+  int fd = toDevice ? this->cloudFd : this->deviceFd;
   
-  if (len <= 0) return;
+  // No room: nothing to read now (a recv of 0 bytes would look like a close)
+  if (buffer.isFull()) return true;
   
-  this->blinkLED();  // Blink LED when receiving data from cloud
+  uint32_t start = micros();
   
-  // Null-terminate for string operations (be careful with binary data)
-  char strBuffer[513];
-  memcpy(strBuffer, buffer, len);
-  strBuffer[len] = '\0';
+  #if FORWARD_DIRECT_RECV
+    // Straight into the free space of the ring, both parts when it wraps
+    size_t len1, len2;
+    uint8_t* data = buffer.reserve(len1);
+    uint8_t* wrapped = buffer.reserveWrapped(len2);
+    int len = socketRecv(fd, data, len1, wrapped, len2);
+    if (len > 0) buffer.commit(len);
+    size_t logged = min((size_t)max(len, 0), len1);  // the part that wrapped isn't logged
+  #else
+    uint8_t data[512];
+    int len = socketRecv(fd, data, min(sizeof(data), buffer.space()));
+    if (len > 0) buffer.write(data, len);
+    size_t logged = max(len, 0);
+  #endif
+  this->proxy->addForwardTime(true, micros() - start);
   
-  if (!this->deviceSocket || !this->deviceConnected) {
-    // No device connection yet - check what kind of message this is
-    
-    if (this->isHeartbeatRequest(strBuffer, len)) {
-      this->proxy->logMessage(FROM_CLOUD, this->connectionId, "Heartbeat request, responding...");
+  if (len < 0) return false;  // connection closed
+  if (len == 0) return true;
+  
+  // Blink LED when forwarding data
+  this->lastActivity = millis();
+  this->blinkLED();
+  this->proxy->logData(direction, logged, data, this->connectionId);
+  
+  // Track statistics
+  this->countTraffic(direction, len);
+  return true;
+}
 
-      // answer the heartbeat request
-      this->cloudSocket->write("[72,3]");
-      return;
-    }
-    
-    if (this->isConnectionResponse(strBuffer, len)) {
-      // response from the server to our connection request
-      this->proxy->logMessage(FROM_CLOUD, this->connectionId, "Connection response: ", strBuffer);
-      return;
-    }
-    
-    // Real data - a new client wants to connect
-    //  -> we need to connect to the device 
-    //     and forward this data + all next data
-    this->proxy->logMessage(FROM_CLOUD, this->connectionId, "New client connection detected");
+unsigned long Context::idleTimeout() const {
+  // Free: the cloud sends heartbeats, attached: client and master keep talking
+  // (while connecting to the master, DEVICE_CONNECT_TIMEOUT applies)
+  if (this->isFree()) return FREE_HEARTBEAT_TIMEOUT;
+  if (this->deviceConnected) return CLIENT_IDLE_TIMEOUT;
+  return 0;
+}
+
+void Context::countTraffic(ConnectionDirection direction, size_t len) {
+  bool toDevice = (direction == CLOUD_TO_DEVICE);
+  (toDevice ? this->toDevice : this->toCloud).add(len);
+  (toDevice ? this->toDeviceLatency : this->toCloudLatency).queued(len, micros());
+  this->proxy->addTraffic(this->route, direction, len);
+}
+
+bool Context::flushBuffer(ConnectionDirection direction) {
+  bool toDevice = (direction == CLOUD_TO_DEVICE);
+  RingBuffer& buffer = toDevice ? this->cloudToDevice : this->deviceToCloud;
+  LatencyTracker& latency = toDevice ? this->toDeviceLatency : this->toCloudLatency;
+  int fd = toDevice ? this->deviceFd : this->cloudFd;
+  
+  while (!buffer.isEmpty()) {
+    // Everything queued goes out in one write, also when it wrapped around the end of the ring:
+    // with TCP_NODELAY every write can become a segment of its own
+    size_t len, wrappedLen;
+    const uint8_t* data = buffer.peek(len);
+    const uint8_t* wrapped = buffer.peekWrapped(wrappedLen);
     
-    // Track statistics - incoming client connection
-    this->proxy->incrementClientConnections();
+    uint32_t start = micros();
+    int sent = socketSend(fd, data, len, wrapped, wrappedLen);
+    uint32_t now = micros();
+    this->proxy->addForwardTime(false, now - start);
+    if (sent < 0) return false;
+    if (sent == 0) break;  // socket send buffer full, the rest stays queued
     
-    // Connect to the device and forward this initial data
-    this->makeDeviceConnection(buffer, len);
+    buffer.consume(sent);
+    latency.sent(sent, now, this->proxy->getLatency(direction));
     
-    // This connection is now busy with a device, so create a new free connection if needed
-    if (this->deviceConnected && !this->proxy->hasFreeConnection()) {
-      Serial.println("[PROXY] Connection now has device attached - creating new free connection...");
-      this->proxy->makeNewCloudConnection();
+    if (toDevice && this->ttfbPending) {
+      // First client data on its way to the master
+      this->ttfbPending = false;
+      this->proxy->recordFirstByte(this->ttfbWarm, now - this->clientStart);
     }
-
-  } else if (this->deviceSocket && this->deviceConnected) {
-    // Forward data to device
-    this->proxy->logData(CLOUD_TO_DEVICE, len, buffer, this->connectionId);
-    this->deviceSocket->write(buffer, len);
-    // Track statistics
-    this->proxy->addBytesTransferred(len);
   }
+  return true;
 }
 
-void Context::makeDeviceConnection(uint8_t* data, size_t len) {
-  const ProxyConfig& config = this->proxy->getConfig();
+void Context::makeDeviceConnection(const uint8_t* data, size_t len) {
+  const RouteConfig& master = this->proxy->getConfig().routes[this->route];
 
-  this->proxy->logDirection(TO_DEVICE);
-  Serial.print("Connecting to device at ");
-  Serial.print(config.masterAddress);
-  Serial.print(":");
-  Serial.println(config.masterPort);
+  char address[24];
+  snprintf(address, sizeof(address), "%s:%u", master.masterAddress, master.masterPort);
   
-  if (!this->deviceSocket) {
-    this->deviceSocket = new WiFiClient();
+  // Pre-connected: take over that socket, connected or still connecting
+  if (this->warmFd >= 0) {
+    this->proxy->logMessage(TO_DEVICE, this->connectionId, "Using pre-connected device at ", address);
+    this->deviceFd = this->warmFd;
+    this->deviceConnected = this->warmConnected;
+    this->deviceConnectStart = this->warmConnectStart;
+    if (this->deviceConnected) this->deviceAttachedAt = millis();
+    this->warmFd = -1;
+    this->warmConnected = false;
+    this->ttfbWarm = true;
+    this->proxy->preconnectUsed();
+    this->proxy->slotChanged(this->slot);  // taken by a client
+    
+    // Queued like below, sent with the first flush
+    this->cloudToDevice.write(data, len);
+    return;
   }
   
+  this->proxy->logMessage(TO_DEVICE, this->connectionId, "Connecting to device at ", address);
+  
   // Parse IP address
   IPAddress deviceIP;
-  if (deviceIP.fromString(config.masterAddress)) {
-    if (this->deviceSocket->connect(deviceIP, config.masterPort)) {
-      this->proxy->logMessage(TO_DEVICE, 0, "Connected to device");
-      this->deviceConnected = true;
-      
-      if (config.debug) {
-        // Send initial data
-        this->proxy->logDirection(TO_DEVICE);
-        Serial.print("Sending initial ");
-        Serial.print(len);
-        Serial.print(" bytes: ");
-        for (int i = 0; i < len; i++) {
-          if (data[i] != 0) Serial.write(data[i]);
-        }
-      }
-      this->deviceSocket->write(data, len);
-      // Track statistics
-      this->proxy->addBytesTransferred(len);
+  if (!deviceIP.fromString(master.masterAddress)) {
+    this->proxy->logMessage(TO_DEVICE, this->connectionId, "Invalid device IP address - closing connection");
+    this->cleanupSockets();
+    return;
+  }
+  
+  // Non-blocking connect, finished by checkDeviceConnection() from loop()
+  this->deviceFd = socketConnectStart(deviceIP, master.masterPort, this->proxy->getConfig().deviceSocket);
+  if (this->deviceFd < 0) {
+    this->proxy->logMessage(TO_DEVICE, this->connectionId, "Failed to connect to device - closing connection");
+    this->cleanupSockets();
+    return;
+  }
+  this->deviceConnectStart = millis();
+  this->proxy->slotChanged(this->slot);  // taken by a client
+  
+  // Keep the initial data until the device is connected (counted by the caller)
+  this->cloudToDevice.write(data, len);
+}
 
-    } else {
-      this->proxy->logMessage(TO_DEVICE, 0, "Failed to connect to device");
-      delete this->deviceSocket;
-      this->deviceSocket = nullptr;
-      this->deviceConnected = false;
+void Context::checkDeviceConnection() {
+  int res = socketConnectCheck(this->deviceFd);
+  
+  if (res == 0) {
+    if (millis() - this->deviceConnectStart >= DEVICE_CONNECT_TIMEOUT) {
+      this->proxy->logMessage(TO_DEVICE, this->connectionId, "Timeout connecting to device - closing connection");
+      this->proxy->connectionTimedOut(TIMEOUT_CONNECT);
+      this->cleanupSockets();
     }
-  } else {
-    this->proxy->logMessage(TO_DEVICE, 0, "Invalid device IP address");
-    delete this->deviceSocket;
-    this->deviceSocket = nullptr;
-    this->deviceConnected = false;
+    return;
+  }
+  
+  if (res < 0) {
+    this->proxy->logMessage(TO_DEVICE, this->connectionId, "Failed to connect to device - closing connection");
+    this->cleanupSockets();
+    return;
+  }
+  
+  this->proxy->logMessage(TO_DEVICE, this->connectionId, "Connected to device");
+  this->deviceConnected = true;
+  this->deviceAttachedAt = millis();
+  
+  // Everything the client sent while we were connecting is queued in cloudToDevice
+  // and goes out in order with the next flush
+  if (this->proxy->getConfig().debug && !this->cloudToDevice.isEmpty()) {
+    char msg[40];
+    snprintf(msg, sizeof(msg), "Sending initial %u bytes", (unsigned)this->cloudToDevice.size());
+    this->proxy->logMessage(TO_DEVICE, this->connectionId, msg);
   }
 }
 
-bool Context::isHeartbeatRequest(const char* data, size_t len) {
-  // Check for [215,3]
-  if (len >= 7) {
-    return (strncmp(data, "[215,3]", 7) == 0);
+void Context::preconnect() {
+  if (this->warmFd >= 0 || !this->isFree()) return;
+  const RouteConfig& master = this->proxy->getConfig().routes[this->route];
+  
+  // Non-blocking connect, finished by checkWarmConnection() from loop()
+  IPAddress deviceIP;
+  if (deviceIP.fromString(master.masterAddress)) {
+    this->warmFd = socketConnectStart(deviceIP, master.masterPort, this->proxy->getConfig().deviceSocket);
   }
-  return false;
+  if (this->warmFd < 0) {
+    this->proxy->preconnectLost();
+    return;
+  }
+  this->warmConnected = false;
+  this->warmConnectStart = millis();
+  this->proxy->logMessage(TO_DEVICE, this->connectionId, "Pre-connecting to device");
 }
 
-bool Context::isConnectionResponse(const char* data, size_t len) {
-  if (len >= 3) {
-    return (strncmp(data, "[OK", 3) == 0) || (strncmp(data, "[ERROR", 6) == 0);
+void Context::checkWarmConnection(const SocketSet& io) {
+  if (this->warmConnected) {
+    // The master doesn't talk before the client does: readable means closed (or broken)
+    if (io.canRead(this->warmFd)) {
+      this->proxy->logMessage(TO_DEVICE, this->connectionId, "Pre-connected device closed the connection");
+      this->closeWarmSocket();
+      this->proxy->preconnectLost();
+    }
+    return;
+  }
+  
+  int res = socketConnectCheck(this->warmFd);
+  if (res > 0) {
+    this->warmConnected = true;
+    this->proxy->logMessage(TO_DEVICE, this->connectionId, "Pre-connected to device");
+  } else if (res < 0 || millis() - this->warmConnectStart >= DEVICE_CONNECT_TIMEOUT) {
+    this->proxy->logMessage(TO_DEVICE, this->connectionId, "Pre-connect to device failed");
+    if (res == 0) this->proxy->connectionTimedOut(TIMEOUT_CONNECT);
+    this->closeWarmSocket();
+    this->proxy->preconnectLost();
+  }
+}
+
+void Context::closeWarmSocket() {
+  if (this->warmFd >= 0) {
+    socketClose(this->warmFd);
+    this->warmFd = -1;
+    this->warmConnected = false;
   }
-  return false;
 }
 
 void Context::blinkLED() {
@@ -223,7 +530,7 @@ void Context::blinkLED() {
     digitalWrite(LED_PIN, HIGH);
     this->ledState = true;
     this->ledOnTime = millis();
-    Serial.println("[LED] RED ON");
+    this->proxy->logDebug("[LED] RED ON");
   #endif
 }
 
@@ -232,7 +539,7 @@ void Context::updateLED() {
     if (this->ledState && (millis() - this->ledOnTime >= LED_BLINK_DURATION)) {
       digitalWrite(LED_PIN, LOW);
       this->ledState = false;
-      Serial.println("[LED] RED OFF");
+      this->proxy->logDebug("[LED] RED OFF");
     }
   #endif
 }
@@ -243,192 +550,720 @@ void Context::updateLED() {
 
 ESPProxy::ESPProxy() {
   this->debug = false;
-  this->connectionCount = 0;
+  this->restartRequested = false;
+  this->lastStatusPublish = 0;
   this->nextConnectionId = 0;
   this->lastConnectionCheck = 0;
-  this->totalBytesTransferred = 0;
+  this->slab = nullptr;
+  this->slabBuffers = nullptr;
+  this->buffersInPsram = false;
+  this->capacity = 0;
+  this->totalToDevice.clear();
+  this->totalToCloud.clear();
   this->totalClientConnections = 0;
+  this->connectTimeouts = 0;
+  this->heartbeatTimeouts = 0;
+  this->idleTimeouts = 0;
+  this->outageSince = 0;
+  this->outages = 0;
+  this->lastRecoveryMs = 0;
+  this->maxRecoveryMs = 0;
+  this->totalRecoveryMs = 0;
+  this->forwardMicros = 0;
+  this->forwardRecvCalls = 0;
+  this->forwardSendCalls = 0;
+  this->preconnectStarted = 0;
+  this->preconnectHits = 0;
+  this->preconnectDropped = 0;
+  this->preconnectRetryAt = 0;
   
-  for (int i = 0; i < MAX_CONNECTIONS; i++) {
-    this->connections[i] = nullptr;
+  for (int r = 0; r < MAX_ROUTES; r++) {
+    Route& route = this->routes[r];
+    route.slots.clear();
+    route.connectWanted = false;
+    route.poolTarget = POOL_MIN_FREE;
+    route.arrivalRate = 0;
+    route.arrivalsInWindow = 0;
+    route.arrivalWindowStart = 0;
+    route.poolHits = 0;
+    route.poolMisses = 0;
+    route.clientConnections = 0;
+    route.toDevice.clear();
+    route.toCloud.clear();
   }
+  this->minLargestFreeBlock = UINT32_MAX;
+  
+  this->cloudState = CLOUD_IDLE;
+  this->cloudRoute = -1;
+  this->cloudFd = -1;
+  this->cloudStateSince = 0;
+  this->cloudNextAttempt = 0;
+  this->cloudRetryCount = 0;
+  this->cloudAttempts = 0;
+  this->cloudFailures = 0;
+  this->cloudRegistrationLen = 0;
+  this->cloudRegistrationSent = 0;
 }
 
 ESPProxy::~ESPProxy() {
   this->cleanStart(false);
+  
+  if (this->slab) {
+    for (int i = 0; i < this->capacity; i++) this->slab[i].~Context();
+    freeMemory(this->slab);
+  }
+  if (this->slabBuffers) freeMemory(this->slabBuffers);
 }
 
 bool ESPProxy::begin(const ProxyConfig& cfg) {
   this->config = cfg;
   this->debug = cfg.debug;
   
+  // Log output first, everything below already goes through it
+  if (!this->logSink.start()) {
+    Serial.println("[ERROR] **** Failed to start log task ****");
+  }
+  
   this->logInfo("ESP Proxy Starting");
 
-  if (strlen(this->config.uniqueId) == 0) {
-    this->logError("No unique ID configured - cannot start proxy");
+  this->config.routeCount = constrain(this->config.routeCount, 1, MAX_ROUTES);
+  for (int r = 0; r < this->config.routeCount; r++) {
+    if (strlen(this->config.routes[r].uniqueId) == 0) {
+      this->logError("No unique ID configured - cannot start proxy");
+      return false;
+    }
+  }
+  
+  // Room for a free connection and a client per route, buffers a frame fits in
+  this->config.capacity = constrain(this->config.capacity, 2 * this->config.routeCount, MAX_CONNECTIONS);
+  this->config.bufferSize = constrain(this->config.bufferSize, FORWARD_BUFFER_MIN, FORWARD_BUFFER_MAX);
+  if (!this->allocateSlots()) {
     return false;
   }
   
-  // Create initial free connection
-  this->makeNewCloudConnection();
+  // Sane pool limits: at least one free connection per route, and room left for clients
+  int maxFree = max(1, (this->capacity - 1) / this->config.routeCount);
+  this->config.poolMinFree = constrain(this->config.poolMinFree, 1, maxFree);
+  this->config.poolMaxFree = constrain(this->config.poolMaxFree, this->config.poolMinFree, maxFree);
+  this->config.preconnect = min(this->config.preconnect, (uint16_t)this->capacity);
+  
+  // Resolved (and cached) when the first connection is made
+  this->cloudDns.begin(this->config.cloudServer);
+  this->timers.clear(millis());
+  
+  // Request an initial free connection per route (set up by loop())
+  for (int r = 0; r < this->config.routeCount; r++) {
+    this->routes[r].poolTarget = this->config.poolMinFree;
+    this->routes[r].arrivalWindowStart = millis();
+    this->makeNewCloudConnection(r);
+  }
   this->lastConnectionCheck = millis();
+  this->publishStatus();
+  
+  return true;
+}
+
+bool ESPProxy::allocateSlots() {
+  // Once: the slots are never reallocated, a new capacity takes a restart
+  if (this->slab) return true;
+  
+  size_t bufferBytes = (size_t)this->config.capacity * 2 * this->config.bufferSize;
+  this->slab = (Context*)allocInternal(this->config.capacity * sizeof(Context));
+  this->slabBuffers = (uint8_t*)allocBulk(bufferBytes, this->buffersInPsram);
+  
+  char msg[LOG_TEXT_SIZE];
+  if (!this->slab || !this->slabBuffers) {
+    snprintf(msg, sizeof(msg), "Not enough memory for %u connections of 2 x %u bytes - cannot start proxy",
+             (unsigned)this->config.capacity, (unsigned)this->config.bufferSize);
+    this->logError(msg);
+    if (this->slab) freeMemory(this->slab);
+    if (this->slabBuffers) freeMemory(this->slabBuffers);
+    this->slab = nullptr;
+    this->slabBuffers = nullptr;
+    return false;
+  }
   
+  this->capacity = this->config.capacity;
+  for (int i = 0; i < this->capacity; i++) {
+    new (&this->slab[i]) Context();
+    this->slab[i].attachBuffers(this->slabBuffers + (size_t)i * 2 * this->config.bufferSize, this->config.bufferSize);
+  }
+  
+  snprintf(msg, sizeof(msg), "%d connection slots, %u KB of buffers in %s", this->capacity,
+           (unsigned)(bufferBytes / 1024), this->buffersInPsram ? "PSRAM" : "internal RAM");
+  this->logInfo(msg);
+  return true;
+}
+
+bool ESPProxy::start() {
+  // Forwarding gets its own core and a high priority,
+  // so the web interface (on the other core) can never hold it up
+  if (!startTask(ESPProxy::proxyTask, "proxy", PROXY_TASK_STACK, this, PROXY_TASK_PRIORITY, PROXY_TASK_CORE)) {
+    this->logError("Failed to start proxy task");
+    return false;
+  }
   return true;
 }
 
+void ESPProxy::proxyTask(void* arg) {
+  ESPProxy* proxy = (ESPProxy*)arg;
+  
+  // A hanging proxy loop restarts the ESP32, nothing else does (see checkOutage())
+  watchdogAdd(PROXY_WATCHDOG_TIMEOUT);
+  for (;;) {
+    proxy->loop();
+    watchdogFeed();
+  }
+}
+
 void ESPProxy::loop() {
-  // Process all existing connections
-  for (int i = 0; i < MAX_CONNECTIONS; i++) {
-    if (this->connections[i] && this->connections[i]->isActive()) {
-      this->connections[i]->loop();
+  unsigned long now = millis();
+  
+  // Collect the sockets every connection is waiting for
+  this->io.clear();
+  for (int i = this->usedSlots.first(); i >= 0; i = this->usedSlots.next(i)) {
+    if (this->slab[i].isActive()) {
+      this->slab[i].watch(this->io);
     }
   }
+  if (this->cloudFd >= 0) {
+    this->io.watchWrite(this->cloudFd);  // cloud connection being set up
+  }
+  
+  // Sleep until one of them is ready or the next timer is due
+  this->io.wait(this->msUntilTimer(now));
+  now = millis();
+  
+  // Process only the connections that have something to do or whose timer expired,
+  // then file their next deadline (on a copy of the used set: a context can remove itself)
+  SlotSet expired = this->timers.expire(now);
+  SlotSet used = this->usedSlots;
+  for (int i = used.first(); i >= 0; i = used.next(i)) {
+    Context& ctx = this->slab[i];
+    if (ctx.isActive() && (ctx.isReady(this->io) || expired.contains(i))) {
+      ctx.loop(this->io);
+      this->scheduleTimer(i);
+    }
+  }
+  
+  // Keep the warm pool filled (and pre-connected), then advance the cloud connection being set up (never blocks)
+  this->maintainPool(now);
+  this->maintainPreconnect(now);
+  this->cloudDns.loop(now);
+  this->driveCloudConnection();
+  
+  // Back from an outage (or stuck in one for too long)
+  if (this->isInOutage()) {
+    this->checkOutage(now);
+  }
   
   // Check if we need a new free connection
-  unsigned long now = millis();
   if (now - this->lastConnectionCheck >= CONNECTION_CHECK_INTERVAL) {
     this->lastConnectionCheck = now;
     this->checkConnections();
   }
   
+  // Restart asked for by the web interface
+  if (this->restartRequested) {
+    this->cleanStart(true);
+  }
+  
+  if (now - this->lastStatusPublish >= STATUS_PUBLISH_INTERVAL) {
+    this->publishStatus();
+  }
+  
   // ESP32 ETH maintains connection automatically - no need for maintain()
 }
 
-void ESPProxy::makeNewCloudConnection(int retryCount) {
-  if (this->connectionCount >= MAX_CONNECTIONS) {
-    this->logError("Maximum connections reached, cannot create new connection");
-    return;
+void ESPProxy::publishStatus() {
+  ProxyStatus& status = this->status;
+  unsigned long now = millis();
+  
+  status.connectionCount = this->usedSlots.count();
+  status.freeConnections = 0;
+  status.activeConnections = 0;
+  status.cloudState = this->cloudState;
+  status.cloudAttempts = this->cloudAttempts;
+  status.cloudFailures = this->cloudFailures;
+  status.dnsHits = this->cloudDns.getHits();
+  status.dnsMisses = this->cloudDns.getMisses();
+  status.dnsStale = this->cloudDns.getStale();
+  status.dnsLookups = this->cloudDns.getLookups();
+  status.dnsFailures = this->cloudDns.getFailures();
+  status.bytesTransferred = this->getTotalBytesTransferred();
+  status.clientConnections = this->totalClientConnections;
+  status.connectTimeouts = this->connectTimeouts;
+  status.heartbeatTimeouts = this->heartbeatTimeouts;
+  status.idleTimeouts = this->idleTimeouts;
+  status.toDevice = this->totalToDevice;
+  status.toCloud = this->totalToCloud;
+  this->latencyToDevice.summarize(status.latencyToDevice);
+  this->latencyToCloud.summarize(status.latencyToCloud);
+  status.outages = this->outages;
+  status.outageMs = this->isInOutage() ? now - this->outageSince : 0;
+  status.lastRecoveryMs = this->lastRecoveryMs;
+  status.maxRecoveryMs = this->maxRecoveryMs;
+  status.totalRecoveryMs = this->totalRecoveryMs;
+  status.forwardMicros = this->forwardMicros;
+  status.forwardRecvCalls = this->forwardRecvCalls;
+  status.forwardSendCalls = this->forwardSendCalls;
+  this->ttfbWarm.summarize(status.ttfbWarm);
+  this->ttfbCold.summarize(status.ttfbCold);
+  status.preconnectBudget = this->config.preconnect;
+  status.preconnectOpen = 0;
+  status.preconnectStarted = this->preconnectStarted;
+  status.preconnectUsed = this->preconnectHits;
+  status.preconnectDropped = this->preconnectDropped;
+  
+  status.poolTarget = 0;
+  status.arrivalRate = 0;
+  status.poolHits = 0;
+  status.poolMisses = 0;
+  status.routeCount = this->config.routeCount;
+  for (int r = 0; r < this->config.routeCount; r++) {
+    const Route& route = this->routes[r];
+    RouteStatus& routeStatus = status.routes[r];
+    routeStatus.freeConnections = this->getFreeConnectionCount(r);
+    routeStatus.activeConnections = route.slots.without(this->freeSlots).count();
+    routeStatus.poolTarget = route.poolTarget;
+    routeStatus.arrivalRate = route.arrivalRate;
+    routeStatus.poolHits = route.poolHits;
+    routeStatus.poolMisses = route.poolMisses;
+    routeStatus.clientConnections = route.clientConnections;
+    routeStatus.toDevice = route.toDevice;
+    routeStatus.toCloud = route.toCloud;
+    
+    status.poolTarget += route.poolTarget;
+    status.arrivalRate += route.arrivalRate;
+    status.poolHits += route.poolHits;
+    status.poolMisses += route.poolMisses;
   }
   
-  Serial.print("[INFO] Attempt ");
-  Serial.print(retryCount);
-  Serial.print(" to make cloud connection to ");
-  Serial.print(this->config.cloudServer);
-  Serial.print(":");
-  Serial.println(this->config.cloudPort);
+  // Contexts are never allocated or freed at runtime, so with a healthy
+  // heap these stay flat however many connections come and go
+  status.freeHeap = ESP.getFreeHeap();
+  status.minFreeHeap = ESP.getMinFreeHeap();
+  status.largestFreeBlock = ESP.getMaxAllocHeap();
+  this->minLargestFreeBlock = min(this->minLargestFreeBlock, status.largestFreeBlock);
+  status.minLargestFreeBlock = this->minLargestFreeBlock;
+  status.capacity = this->capacity;
+  status.bufferSize = this->config.bufferSize;
+  status.slotBytes = sizeof(Context);
+  status.slotBufferBytes = 2 * this->config.bufferSize;
+  status.buffersInPsram = this->buffersInPsram;
+  status.slabSize = this->capacity * (status.slotBytes + status.slotBufferBytes);
+  status.psramSize = psramSize();
+  status.psramFree = psramFree();
+  status.logDropped = this->logSink.getDropped();
   
-  WiFiClient* cloudSocket = new WiFiClient();
+  for (int i = 0; i < this->capacity; i++) {
+    SlotStatus& slot = status.slots[i];
+    slot.used = this->usedSlots.contains(i);
+    if (!slot.used) continue;
+    const Context* conn = &this->slab[i];
+    
+    slot.id = conn->getConnectionId();
+    slot.route = conn->getRoute();
+    slot.free = conn->isFree();
+    slot.cloudSocket = conn->hasCloudSocket();
+    slot.cloudConnected = conn->isCloudConnected();
+    slot.deviceSocket = conn->hasDeviceSocket();
+    slot.deviceConnected = conn->isDeviceConnected();
+    slot.deviceConnecting = conn->isDeviceConnecting();
+    slot.deviceWarm = conn->hasWarmSocket();
+    if (slot.deviceWarm) status.preconnectOpen++;
+    slot.cloudToDevice = conn->getCloudToDeviceQueued();
+    slot.deviceToCloud = conn->getDeviceToCloudQueued();
+    slot.toDevice = conn->getTrafficToDevice();
+    slot.toCloud = conn->getTrafficToCloud();
+    slot.ageMs = now - conn->getCreatedAt();
+    slot.attachedMs = conn->getDeviceAttachedAt() ? now - conn->getDeviceAttachedAt() : 0;
+    slot.idleMs = now - conn->getLastActivity();
+    
+    if (slot.free) {
+      status.freeConnections++;
+    } else {
+      status.activeConnections++;
+    }
+  }
   
-  // Resolve hostname or parse IP
-  IPAddress serverIP;
-  if (!serverIP.fromString(this->config.cloudServer)) {
-    // Try DNS resolution - ESP32 uses WiFi class for DNS
-    if (WiFi.hostByName(this->config.cloudServer, serverIP) != 1) {
-      this->logError("Failed to resolve cloud server hostname");
-      delete cloudSocket;
-      
-      if (retryCount < 3) {
-        delay(retryCount * retryCount * 1000); // Exponential backoff
-        this->makeNewCloudConnection(retryCount + 1);
+  this->snapshot.publish(status);
+  this->lastStatusPublish = millis();
+}
+
+unsigned long ESPProxy::msUntilTimer(unsigned long now) const {
+  unsigned long wait = PROXY_LOOP_MAX_WAIT;
+  
+  unsigned long elapsed = now - this->lastConnectionCheck;
+  wait = min(wait, (elapsed >= CONNECTION_CHECK_INTERVAL) ? 0 : CONNECTION_CHECK_INTERVAL - elapsed);
+  
+  elapsed = now - this->lastStatusPublish;
+  wait = min(wait, (elapsed >= STATUS_PUBLISH_INTERVAL) ? 0 : STATUS_PUBLISH_INTERVAL - elapsed);
+  
+  switch (this->cloudState) {
+    case CLOUD_IDLE:
+      if (this->nextWantedRoute() >= 0) {
+        long left = (long)(this->cloudNextAttempt - now);  // backoff timer
+        wait = min(wait, (unsigned long)max(left, 0L));
       }
-      return;
-    }
+      break;
+    case CLOUD_RESOLVING:
+      break;  // see below
+    case CLOUD_CONNECTING:
+    case CLOUD_REGISTERING:
+      elapsed = now - this->cloudStateSince;
+      wait = min(wait, (elapsed >= CLOUD_CONNECT_TIMEOUT) ? 0 : CLOUD_CONNECT_TIMEOUT - elapsed);
+      break;
+    case CLOUD_READY:
+      wait = 0;
+      break;
   }
   
-  // Connect to cloud server
-  if (cloudSocket->connect(serverIP, this->config.cloudPort)) {
-    Serial.print("[PROXY -> CLOUD] Connected to cloud at ");
-    Serial.print(this->config.cloudServer);
-    Serial.print(":");
-    Serial.println(this->config.cloudPort);
-    
-    // Send unique ID
-    cloudSocket->print("[");
-    cloudSocket->print(this->config.uniqueId);
-    cloudSocket->print("]");
+  // The DNS callback can't wake up select(), so poll for the answer
+  // (also for background refreshes of the cloud address)
+  if (this->cloudDns.isResolving()) {
+    wait = min(wait, (unsigned long)CLOUD_DNS_POLL);
+  }
+  
+  // Connection timeouts: only the next one, not a walk over all slots
+  wait = min(wait, this->timers.msUntilNext(now));
+  return wait;
+}
+
+void ESPProxy::scheduleTimer(int slot) {
+  const Context& ctx = this->slab[slot];
+  unsigned long now = millis();
+  unsigned long wait = (this->usedSlots.contains(slot) && ctx.isActive()) ? ctx.msUntilTimer(now) : NO_TIMER;
+  if (wait == NO_TIMER) {
+    this->timers.cancel(slot);
+  } else {
+    this->timers.schedule(slot, now + wait);
+  }
+}
+
+void ESPProxy::makeNewCloudConnection(int route) {
+  // Only flag the request, the connection is set up step by step in loop()
+  // so a slow or dead cloud server never stalls the other connections
+  if (this->getConnectionCount() >= this->capacity) {
+    this->logError("Maximum connections reached, cannot create new connection");
+    return;
+  }
+  this->routes[route].connectWanted = true;
+}
+
+int ESPProxy::nextWantedRoute() const {
+  // Round robin, starting after the route we connected for last:
+  // a route whose master ID the cloud keeps refusing can't starve the others
+  for (int i = 1; i <= this->config.routeCount; i++) {
+    int r = (this->cloudRoute + i + this->config.routeCount) % this->config.routeCount;
+    if (this->routes[r].connectWanted) return r;
+  }
+  return -1;
+}
+
+void ESPProxy::driveCloudConnection() {
+  unsigned long now = millis();
+  
+  switch (this->cloudState) {
+    case CLOUD_IDLE: {
+      int route = this->nextWantedRoute();
+      if (route < 0) return;
+      if ((long)(now - this->cloudNextAttempt) < 0) return;  // backoff timer still running
+      if (this->getConnectionCount() >= this->capacity) {
+        for (int r = 0; r < MAX_ROUTES; r++) this->routes[r].connectWanted = false;
+        return;
+      }
+      
+      // Taken on: asked for again if this attempt fails
+      this->cloudRoute = route;
+      this->routes[route].connectWanted = false;
+      
+      this->cloudAttempts++;
+      // Route first, a long host name is cut short to fit a log line
+      // (route < MAX_ROUTES: as a byte the worst case is 79 characters)
+      char msg[LOG_TEXT_SIZE];
+      snprintf(msg, sizeof(msg), "Route %u: cloud attempt %d to %.32s:%u",
+               (uint8_t)route, this->cloudRetryCount + 1, this->config.cloudServer, this->config.cloudPort);
+      this->logInfo(msg);
+      
+      // Plain IP address - no DNS needed
+      if (this->cloudIP.fromString(this->config.cloudServer)) {
+        this->startCloudConnect();
+        break;
+      }
+      
+      // Cached address (even an expired one), only the very first lookup is waited for
+      if (this->cloudDns.lookup(this->cloudIP, now)) {
+        this->startCloudConnect();
+      } else if (this->cloudDns.isResolving()) {
+        this->setCloudState(CLOUD_RESOLVING);
+      } else {
+        this->cloudConnectFailed("Failed to resolve cloud server hostname");
+      }
+      break;
+    }
     
-    this->logMessage(TO_CLOUD, 0, "Sent unique ID: ", this->config.uniqueId);
+    case CLOUD_RESOLVING:
+      // The cache gives up on the lookup after CLOUD_DNS_TIMEOUT
+      if (this->cloudDns.hasAddress()) {
+        this->cloudIP = this->cloudDns.getAddress();
+        this->startCloudConnect();
+      } else if (!this->cloudDns.isResolving()) {
+        this->cloudConnectFailed("Failed to resolve cloud server hostname");
+      }
+      break;
     
-    // Create context and add to pool with unique ID
-    this->nextConnectionId++;
-    Context* ctx = new Context(cloudSocket, this, this->nextConnectionId);
+    case CLOUD_CONNECTING: {
+      int res = socketConnectCheck(this->cloudFd);
+      if (res < 0) {
+        this->cloudConnectFailed("Failed to connect to cloud server");
+      } else if (res > 0) {
+        char address[sizeof(this->config.cloudServer) + 8];
+        snprintf(address, sizeof(address), "%s:%u", this->config.cloudServer, this->config.cloudPort);
+        this->logMessage(TO_CLOUD, 0, "Connected to cloud at ", address);
+        
+        // Registration is sent as one message: [uniqueId]
+        this->cloudRegistrationLen = snprintf(this->cloudRegistration, sizeof(this->cloudRegistration),
+                                              "[%s]", this->config.routes[this->cloudRoute].uniqueId);
+        this->cloudRegistrationSent = 0;
+        this->setCloudState(CLOUD_REGISTERING);
+      } else if (now - this->cloudStateSince >= CLOUD_CONNECT_TIMEOUT) {
+        this->cloudConnectFailed("Timeout connecting to cloud server");
+      }
+      break;
+    }
     
-    // Find empty slot
-    for (int i = 0; i < MAX_CONNECTIONS; i++) {
-      if (this->connections[i] == nullptr) {
-        this->connections[i] = ctx;
-        this->connectionCount++;
-        this->logMessage(TO_CLOUD, this->nextConnectionId, "New free connection");
+    case CLOUD_REGISTERING: {
+      int sent = socketSend(this->cloudFd, (const uint8_t*)this->cloudRegistration + this->cloudRegistrationSent,
+                            this->cloudRegistrationLen - this->cloudRegistrationSent);
+      if (sent < 0) {
+        this->cloudConnectFailed("Failed to send unique ID to cloud server");
         break;
       }
+      this->cloudRegistrationSent += sent;
+      
+      if (this->cloudRegistrationSent >= this->cloudRegistrationLen) {
+        this->logMessage(TO_CLOUD, 0, "Sent unique ID: ", this->config.routes[this->cloudRoute].uniqueId);
+        this->setCloudState(CLOUD_READY);
+      } else if (now - this->cloudStateSince >= CLOUD_CONNECT_TIMEOUT) {
+        this->cloudConnectFailed("Timeout sending unique ID to cloud server");
+      }
+      break;
     }
     
-  } else {
-    this->logError("Failed to connect to cloud server");
-    delete cloudSocket;
-    
-    if (retryCount < 3) {
-      delay(retryCount * retryCount * 1000); // Exponential backoff
-      this->makeNewCloudConnection(retryCount + 1);
+    case CLOUD_READY: {
+      // Hand the socket to the context of an empty slot, with a unique ID
+      int i = this->usedSlots.firstMissing();
+      if (i >= 0 && i < this->capacity) {
+        this->nextConnectionId++;
+        this->slab[i].open(i, this->cloudFd, this, this->nextConnectionId, this->cloudRoute);
+        this->usedSlots.add(i);
+        this->routes[this->cloudRoute].slots.add(i);
+        this->slotChanged(i);
+        this->scheduleTimer(i);
+        this->logMessage(TO_CLOUD, this->nextConnectionId, "New free connection");
+      } else {
+        // No empty slot after all (shouldn't happen, IDLE checks the connection count)
+        socketClose(this->cloudFd);
+      }
+      this->cloudFd = -1;  // now owned by the context
+      
+      this->cloudRetryCount = 0;
+      this->setCloudState(CLOUD_IDLE);
+      break;
     }
   }
 }
 
+void ESPProxy::startCloudConnect() {
+  // Non-blocking connect, finished in CLOUD_CONNECTING
+  this->cloudFd = socketConnectStart(this->cloudIP, this->config.cloudPort, this->config.cloudSocket);
+  if (this->cloudFd < 0) {
+    this->cloudConnectFailed("Failed to connect to cloud server");
+    return;
+  }
+  this->setCloudState(CLOUD_CONNECTING);
+}
+
+void ESPProxy::setCloudState(CloudConnectState state) {
+  this->cloudState = state;
+  this->cloudStateSince = millis();
+}
+
+void ESPProxy::cloudConnectFailed(const char* reason) {
+  this->logError(reason);
+  if (this->cloudState == CLOUD_CONNECTING) {
+    // Maybe the cloud server moved: look up its address again
+    this->cloudDns.suspect();
+  }
+  this->routes[this->cloudRoute].connectWanted = true;  // try again after the backoff
+  this->closeCloudAttempt();
+  this->cloudFailures++;
+  
+  // Exponential backoff with jitter: wait between half and the full backoff time,
+  // so several proxies behind one flaky uplink don't retry in lockstep
+  this->cloudRetryCount++;
+  unsigned long backoff = CLOUD_BACKOFF_MAX;
+  if (this->cloudRetryCount < 16) {
+    backoff = min((unsigned long)CLOUD_BACKOFF_MIN << (this->cloudRetryCount - 1), (unsigned long)CLOUD_BACKOFF_MAX);
+  }
+  backoff = backoff / 2 + random(backoff / 2 + 1);
+  this->cloudNextAttempt = millis() + backoff;
+}
+
+void ESPProxy::closeCloudAttempt() {
+  socketClose(this->cloudFd);
+  this->cloudFd = -1;
+  this->setCloudState(CLOUD_IDLE);
+}
+
 void ESPProxy::checkConnections() {
   
   // Remove inactive connections
-  for (int i = 0; i < MAX_CONNECTIONS; i++) {
-    if (this->connections[i] && !this->connections[i]->isActive()) {
+  SlotSet used = this->usedSlots;
+  for (int i = used.first(); i >= 0; i = used.next(i)) {
+    if (!this->slab[i].isActive()) {
       this->logDebug("Removing inactive connection...");
-      delete this->connections[i];
-      this->connections[i] = nullptr;
-      this->connectionCount--;
+      this->slab[i].cleanupSockets();
+      this->timers.cancel(i);
+      this->usedSlots.remove(i);
+      this->freeSlots.remove(i);
+      this->routes[this->slab[i].getRoute()].slots.remove(i);
     }
   }
+  if (this->usedSlots.isEmpty() && !this->isInOutage()) {
+    this->outageStarted();
+  }
   
-  // Check if we have at least one free connection
-  if (this->hasFreeConnection()) {
-    this->logDebug("Found free connection - OK");
+  for (int r = 0; r < this->config.routeCount; r++) {
+    // Check if we have at least one free connection
+    // (maintainPool() refills as soon as one is taken, this is just the periodic report)
+    int freeCount = this->getFreeConnectionCount(r);
+    if (freeCount > 0) {
+      this->logDebug("Found free connection - OK");
+    } else {
+      this->logError("No free connections available - creating new connection...");
+      this->makeNewCloudConnection(r);
+    }
+    
+    // Shrink slowly when the arrival rate went down: one connection per check
+    if (freeCount > this->routes[r].poolTarget) {
+      Context& ctx = this->slab[this->routes[r].slots.intersect(this->freeSlots).first()];
+      this->logMessage(TO_CLOUD, ctx.getConnectionId(), "Closing surplus free connection");
+      this->removeConnection(&ctx);
+    }
+  }
+}
+
+void ESPProxy::clientAttached(int route) {
+  Route& r = this->routes[route];
+  this->totalClientConnections++;
+  r.clientConnections++;
+  r.arrivalsInWindow++;
+  
+  if (this->hasFreeConnection(route)) {
+    r.poolHits++;
   } else {
-    this->logError("No free connections available - creating new connection...");
-    // Try to create a new connection instead of restarting
-    this->makeNewCloudConnection();
+    r.poolMisses++;
+    this->logInfo("Last free connection taken by a client - creating new free connection...");
   }
+  
+  // Don't wait for the next check, start refilling now
+  this->maintainPool(route, millis());
 }
 
-bool ESPProxy::hasFreeConnection() {
-  for (int i = 0; i < MAX_CONNECTIONS; i++) {
-    if (this->connections[i] && this->connections[i]->isFree()) {
-      return true;
-    }
+void ESPProxy::maintainPool(unsigned long now) {
+  for (int r = 0; r < this->config.routeCount; r++) {
+    this->maintainPool(r, now);
   }
-  return false;
 }
 
-int ESPProxy::getFreeConnectionCount() const {
-  int count = 0;
-  for (int i = 0; i < MAX_CONNECTIONS; i++) {
-    if (this->connections[i] && this->connections[i]->isFree()) {
-      count++;
-    }
+void ESPProxy::maintainPool(int route, unsigned long now) {
+  Route& r = this->routes[route];
+  
+  // Follow the client arrival rate: moving average over POOL_RATE_WINDOW windows
+  unsigned long elapsed = now - r.arrivalWindowStart;
+  if (elapsed >= POOL_RATE_WINDOW) {
+    float windowRate = r.arrivalsInWindow * 1000.0f / elapsed;
+    r.arrivalRate = 0.7f * r.arrivalRate + 0.3f * windowRate;
+    r.arrivalsInWindow = 0;
+    r.arrivalWindowStart = now;
+    
+    // Enough free connections for the clients expected over the next POOL_RATE_HORIZON seconds
+    int expected = (int)(r.arrivalRate * POOL_RATE_HORIZON + 0.5f);
+    r.poolTarget = constrain(this->config.poolMinFree + expected, 
+                             (int)this->config.poolMinFree, (int)this->config.poolMaxFree);
+  }
+  
+  // Refill one connection at a time, the next one starts as soon as this one is registered
+  if (!this->isCloudConnectPending(route) && this->getConnectionCount() < this->capacity &&
+      this->getFreeConnectionCount(route) < r.poolTarget) {
+    this->makeNewCloudConnection(route);
   }
-  return count;
 }
 
-int ESPProxy::getActiveConnectionCount() const {
-  int count = 0;
-  for (int i = 0; i < MAX_CONNECTIONS; i++) {
-    if (this->connections[i] && !this->connections[i]->isFree()) {
-      count++;
+void ESPProxy::maintainPreconnect(unsigned long now) {
+  // Budget over all routes: every pre-connect is an idle connection on a master
+  if (this->config.preconnect == 0) return;
+  if ((long)(now - this->preconnectRetryAt) < 0) return;  // a master just refused or dropped one
+  
+  int warm = 0;
+  int candidate = -1;
+  for (int i = this->freeSlots.first(); i >= 0; i = this->freeSlots.next(i)) {
+    if (this->slab[i].hasWarmSocket()) {
+      warm++;
+    } else if (candidate < 0) {
+      candidate = i;
     }
   }
-  return count;
+  
+  // One at a time, like the pool itself
+  if (warm < this->config.preconnect && candidate >= 0) {
+    this->preconnectStarted++;
+    this->slab[candidate].preconnect();
+    this->scheduleTimer(candidate);  // connect timeout
+  }
+}
+
+void ESPProxy::preconnectLost() {
+  // Don't hammer a master that refuses or closes idle connections
+  this->preconnectDropped++;
+  this->preconnectRetryAt = millis() + DEVICE_PRECONNECT_RETRY;
+}
+
+void ESPProxy::connectionTimedOut(TimeoutKind kind) {
+  switch (kind) {
+    case TIMEOUT_CONNECT:   this->connectTimeouts++; break;
+    case TIMEOUT_HEARTBEAT: this->heartbeatTimeouts++; break;
+    case TIMEOUT_IDLE:      this->idleTimeouts++; break;
+  }
+}
+
+void ESPProxy::slotChanged(int slot) {
+  // Only used slots can be free, the context decides whether it is
+  this->freeSlots.assign(slot, this->usedSlots.contains(slot) && this->slab[slot].isFree());
 }
 
 void ESPProxy::cleanStart(bool restart) {
   this->logInfo("Cleaning up connections...");
   
-  for (int i = 0; i < MAX_CONNECTIONS; i++) {
-    if (this->connections[i]) {
-      this->connections[i]->cleanupSockets();
-      delete this->connections[i];
-      this->connections[i] = nullptr;
-    }
+  for (int i = this->usedSlots.first(); i >= 0; i = this->usedSlots.next(i)) {
+    this->slab[i].cleanupSockets();
   }
-    
-  this->connectionCount = 0;
+  this->usedSlots.clear();
+  this->freeSlots.clear();
+  this->timers.clear(millis());
+  for (int r = 0; r < MAX_ROUTES; r++) {
+    this->routes[r].slots.clear();
+    this->routes[r].connectWanted = false;
+  }
+  
   this->nextConnectionId = 0;
   this->lastConnectionCheck = millis();
+  
+  // Abort a cloud connection that was being set up
+  this->closeCloudAttempt();
+  this->cloudRetryCount = 0;
 
 
   if (restart) {
@@ -439,19 +1274,47 @@ void ESPProxy::cleanStart(bool restart) {
 }
 
 void ESPProxy::removeConnection(Context* ctx) {
-  for (int i = 0; i < MAX_CONNECTIONS; i++) {
-    if (this->connections[i] == ctx) {
-      this->connections[i]->cleanupSockets();
-      delete this->connections[i];
-      this->connections[i] = nullptr;
-      this->connectionCount--;
-      
-      if (this->connectionCount == 0) {
-        this->logError("No more connections - restarting");
-        this->cleanStart(true);
-      }
-      return;
-    }
+  int slot = ctx->getSlot();
+  if (slot < 0 || !this->usedSlots.contains(slot)) return;
+  
+  ctx->cleanupSockets();  // slot is reused by the next connection
+  this->timers.cancel(slot);
+  this->usedSlots.remove(slot);
+  this->freeSlots.remove(slot);
+  this->routes[ctx->getRoute()].slots.remove(slot);
+  
+  if (this->usedSlots.isEmpty() && !this->isInOutage()) {
+    this->outageStarted();
+  }
+}
+
+void ESPProxy::outageStarted() {
+  // Nothing to restart for: maintainPool() asks for new free connections for every route
+  // and the cloud connection backs off while the cloud can't be reached
+  this->outageSince = max(millis(), 1UL);
+  this->outages++;
+  this->logError("No more connections - rebuilding the free connections");
+}
+
+void ESPProxy::checkOutage(unsigned long now) {
+  if (!this->usedSlots.isEmpty()) {
+    // A new connection made it to the cloud: recovered
+    uint32_t recovery = now - this->outageSince;
+    this->outageSince = 0;
+    this->lastRecoveryMs = recovery;
+    this->maxRecoveryMs = max(this->maxRecoveryMs, recovery);
+    this->totalRecoveryMs += recovery;
+    
+    char msg[LOG_TEXT_SIZE];
+    snprintf(msg, sizeof(msg), "Connections restored after %lu ms", (unsigned long)recovery);
+    this->logInfo(msg);
+    return;
+  }
+  
+  // Restarting is the last resort: it also brings up Ethernet, DHCP and mDNS again
+  if (OUTAGE_RESTART_TIMEOUT > 0 && now - this->outageSince >= OUTAGE_RESTART_TIMEOUT) {
+    this->logError("No connections for too long - restarting");
+    this->cleanStart(true);
   }
 }
 
@@ -461,75 +1324,26 @@ void ESPProxy::removeConnection(Context* ctx) {
 
 void ESPProxy::logDebug(const char* msg) {
   if (this->debug) {
-    Serial.print("[DEBUG] ");
-    Serial.println(msg);
+    this->logSink.write(LOG_DEBUG, msg);
   }
 }
 
 void ESPProxy::logInfo(const char* msg) {
-  Serial.print("[INFO] ");
-  Serial.println(msg);
+  this->logSink.write(LOG_INFO, msg);
 }
 
-
 void ESPProxy::logError(const char* msg) {
-  Serial.print("[ERROR] **** ");
-  Serial.print(msg);
-  Serial.println(" ****");
-}
-
-void ESPProxy::logDirection(ConnectionDirection direction) {
-  switch (direction) {
-    case DEVICE_TO_CLOUD:
-      Serial.print("[DEVICE -> CLOUD] ");
-      break;
-    case CLOUD_TO_DEVICE:
-      Serial.print("[CLOUD -> DEVICE] ");
-      break;
-    case FROM_CLOUD:
-      Serial.print("[CLOUD -> PROXY] ");
-      break;
-    case TO_DEVICE:
-      Serial.print("[PROXY -> DEVICE] ");
-      break;
-    case TO_CLOUD:
-      Serial.print("[PROXY -> CLOUD] ");
-      break;
-    default:
-      Serial.print("[UNKNOWN] ");
-      break;
-  }
+  this->logSink.write(LOG_ERROR, msg);
 }
 
 void ESPProxy::logData(ConnectionDirection direction, int len, const uint8_t* buffer, int connectionId) {
   if (!this->debug) return;
-
-  this->logDirection(direction);
-  Serial.print("conn #");
-  Serial.print(connectionId);
-  Serial.print(": Forwarding ");
-  Serial.print(len);
-  Serial.print(" bytes: ");
-  for (int i = 0; i < len; i++) {
-    if (buffer[i] != 0) Serial.write(buffer[i]);
-  }
+  
+  // Only the first LOG_TEXT_SIZE bytes are kept, copying the whole chunk isn't worth it
+  this->logSink.writeData(direction, connectionId, buffer, len);
 }
 
 void ESPProxy::logMessage(ConnectionDirection direction, int connectionId, 
                           const char* message, const char* extraStr) {
-
-  this->logDirection(direction);
-  if (connectionId) {
-    Serial.print("conn #");
-    Serial.print(connectionId);
-    Serial.print(": ");
-  }
-  
-  Serial.print(message);
-  
-  if (extraStr) {
-    Serial.println(extraStr);
-  } else {
-    Serial.println();
-  }
-}
\ No newline at end of file
+  this->logSink.write(LOG_MESSAGE, message, extraStr, direction, connectionId);
+}
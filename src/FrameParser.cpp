@@ -0,0 +1,101 @@
+#include "FrameParser.h"
+
+// Control frames we may get on a free connection
+static const char HEARTBEAT[] = "[215,3]";
+static const char* const RESPONSES[] = { "[OK", "[ERROR" };
+
+// true if s starts with the first len bytes of pattern
+static bool startsLike(const char* s, size_t len, const char* pattern) {
+  size_t patternLen = strlen(pattern);
+  return memcmp(s, pattern, min(len, patternLen)) == 0;
+}
+
+void FrameParser::reset() {
+  this->state = OUTSIDE;
+  this->afterFrame = false;
+  this->heldLen = 0;
+  this->held[0] = '\0';
+}
+
+size_t FrameParser::findByte(const uint8_t* data, size_t len, uint8_t c) {
+  // A word with a zero byte has (x - 0x01..) & ~x & 0x80.. != 0,
+  // xor with c in every byte makes the bytes equal to c zero
+  const uint32_t pattern = 0x01010101UL * c;
+  size_t i = 0;
+  for (; i + 4 <= len; i += 4) {
+    uint32_t word;
+    memcpy(&word, data + i, 4);  // unaligned load
+    uint32_t x = word ^ pattern;
+    if ((x - 0x01010101UL) & ~x & 0x80808080UL) break;
+  }
+  for (; i < len; i++) {
+    if (data[i] == c) return i;
+  }
+  return len;
+}
+
+FrameType FrameParser::next(const uint8_t* data, size_t len, size_t& pos) {
+  while (pos < len) {
+    switch (this->state) {
+      case OUTSIDE: {
+        uint8_t c = data[pos];
+        if (this->afterFrame && (c == '\r' || c == '\n' || c == ' ')) {
+          pos++;  // line end after a control frame
+          break;
+        }
+        if (c != '[') {
+          // Not a frame at all, must be a client
+          this->heldLen = 0;
+          this->held[0] = '\0';
+          return FRAME_CLIENT;
+        }
+        this->held[0] = '[';
+        this->held[1] = '\0';
+        this->heldLen = 1;
+        this->state = PREFIX;
+        pos++;
+        break;
+      }
+
+      case PREFIX: {
+        this->held[this->heldLen++] = data[pos++];
+        this->held[this->heldLen] = '\0';
+
+        bool possible = false;
+        if (startsLike(this->held, this->heldLen, HEARTBEAT)) {
+          if (this->heldLen == strlen(HEARTBEAT)) {
+            this->state = OUTSIDE;
+            this->afterFrame = true;
+            return FRAME_HEARTBEAT;
+          }
+          possible = true;
+        }
+        for (size_t i = 0; i < sizeof(RESPONSES) / sizeof(RESPONSES[0]); i++) {
+          if (startsLike(this->held, this->heldLen, RESPONSES[i])) {
+            if (this->heldLen == strlen(RESPONSES[i])) {
+              this->state = RESPONSE;  // the rest of it doesn't matter
+            }
+            possible = true;
+          }
+        }
+
+        // Doesn't look like any control frame (the prefix never outgrows them)
+        if (!possible) return FRAME_CLIENT;
+        break;
+      }
+
+      case RESPONSE: {
+        size_t end = findByte(data + pos, len - pos, ']');
+        if (end == len - pos) {
+          pos = len;  // ends in a next read
+          break;
+        }
+        pos += end + 1;
+        this->state = OUTSIDE;
+        this->afterFrame = true;
+        return FRAME_RESPONSE;
+      }
+    }
+  }
+  return FRAME_NONE;
+}
@@ -0,0 +1,190 @@
+#include "LogSink.h"
+#include "TaskUtil.h"
+
+LogSink::LogSink() {
+  for (uint32_t i = 0; i < LOG_RING_SIZE; i++) {
+    this->cells[i].sequence.store(i, std::memory_order_relaxed);
+  }
+  this->enqueuePos.store(0, std::memory_order_relaxed);
+  this->dequeuePos.store(0, std::memory_order_relaxed);
+  this->dropped.store(0, std::memory_order_relaxed);
+  this->droppedReported = 0;
+  this->started = false;
+}
+
+bool LogSink::start() {
+  if (this->started) return true;
+
+  this->started = startTask(LogSink::drainTask, "log", LOG_TASK_STACK, this, LOG_TASK_PRIORITY, LOG_TASK_CORE);
+  return this->started;
+}
+
+bool LogSink::write(LogLevel level, const char* text, const char* extra,
+                    ConnectionDirection direction, int connectionId) {
+  uint32_t pos;
+  Cell* cell = this->claim(pos);
+  if (!cell) return false;
+
+  LogRecord& record = cell->record;
+  record.time = millis();
+  record.level = level;
+  record.direction = direction;
+  record.length = 0;
+  record.connectionId = connectionId;
+  snprintf(record.text, sizeof(record.text), "%s%s", text, extra ? extra : "");
+
+  this->commit(cell, pos);
+  return true;
+}
+
+bool LogSink::writeData(ConnectionDirection direction, int connectionId, const uint8_t* data, size_t len) {
+  uint32_t pos;
+  Cell* cell = this->claim(pos);
+  if (!cell) return false;
+
+  LogRecord& record = cell->record;
+  record.time = millis();
+  record.level = LOG_DATA;
+  record.direction = direction;
+  record.length = min(len, (size_t)UINT16_MAX);
+  record.connectionId = connectionId;
+  memcpy(record.text, data, min(len, sizeof(record.text)));
+
+  this->commit(cell, pos);
+  return true;
+}
+
+LogSink::Cell* LogSink::claim(uint32_t& pos) {
+  pos = this->enqueuePos.load(std::memory_order_relaxed);
+  for (;;) {
+    Cell* cell = &this->cells[pos & (LOG_RING_SIZE - 1)];
+    uint32_t seq = cell->sequence.load(std::memory_order_acquire);
+    int32_t diff = (int32_t)(seq - pos);
+
+    if (diff == 0) {
+      // Our turn for this cell, unless another producer beats us to it
+      if (this->enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+        return cell;
+      }
+    } else if (diff < 0) {
+      // Not read yet since the previous round: full
+      this->dropped.fetch_add(1, std::memory_order_relaxed);
+      return nullptr;
+    } else {
+      pos = this->enqueuePos.load(std::memory_order_relaxed);
+    }
+  }
+}
+
+void LogSink::commit(Cell* cell, uint32_t pos) {
+  cell->sequence.store(pos + 1, std::memory_order_release);
+}
+
+bool LogSink::read(LogRecord& record) {
+  uint32_t pos = this->dequeuePos.load(std::memory_order_relaxed);
+  Cell* cell = &this->cells[pos & (LOG_RING_SIZE - 1)];
+
+  // Empty, or the producer of this cell hasn't finished writing it
+  if (cell->sequence.load(std::memory_order_acquire) != pos + 1) return false;
+
+  memcpy(&record, &cell->record, sizeof(LogRecord));
+  this->dequeuePos.store(pos + 1, std::memory_order_relaxed);
+  cell->sequence.store(pos + LOG_RING_SIZE, std::memory_order_release);  // free for the next round
+  return true;
+}
+
+void LogSink::drainTask(void* arg) {
+  LogSink* sink = (LogSink*)arg;
+  LogRecord record;
+
+  for (;;) {
+    bool any = false;
+    while (sink->read(record)) {
+      sink->print(record);
+      any = true;
+    }
+
+    uint32_t dropped = sink->getDropped();
+    if (dropped != sink->droppedReported) {
+      Serial.print("[LOG] **** ");
+      Serial.print(dropped - sink->droppedReported);
+      Serial.println(" log messages dropped ****");
+      sink->droppedReported = dropped;
+    }
+
+    if (!any) taskSleep(LOG_DRAIN_INTERVAL);
+  }
+}
+
+void LogSink::print(const LogRecord& record) {
+  char stamp[16];
+  snprintf(stamp, sizeof(stamp), "%lu.%03lu ", (unsigned long)record.time / 1000, (unsigned long)record.time % 1000);
+  Serial.print(stamp);
+
+  switch (record.level) {
+    case LOG_DEBUG:
+      Serial.print("[DEBUG] ");
+      Serial.println(record.text);
+      break;
+
+    case LOG_INFO:
+      Serial.print("[INFO] ");
+      Serial.println(record.text);
+      break;
+
+    case LOG_ERROR:
+      Serial.print("[ERROR] **** ");
+      Serial.print(record.text);
+      Serial.println(" ****");
+      break;
+
+    case LOG_MESSAGE:
+      printDirection(record.direction);
+      if (record.connectionId) {
+        Serial.print("conn #");
+        Serial.print(record.connectionId);
+        Serial.print(": ");
+      }
+      Serial.println(record.text);
+      break;
+
+    case LOG_DATA: {
+      printDirection(record.direction);
+      Serial.print("conn #");
+      Serial.print(record.connectionId);
+      Serial.print(": Forwarding ");
+      Serial.print(record.length);
+      Serial.print(" bytes: ");
+
+      size_t shown = min((size_t)record.length, sizeof(record.text));
+      for (size_t i = 0; i < shown; i++) {
+        if (record.text[i] != 0) Serial.write((uint8_t)record.text[i]);
+      }
+      Serial.println(shown < record.length ? "..." : "");
+      break;
+    }
+  }
+}
+
+void LogSink::printDirection(uint8_t direction) {
+  switch (direction) {
+    case DEVICE_TO_CLOUD:
+      Serial.print("[DEVICE -> CLOUD] ");
+      break;
+    case CLOUD_TO_DEVICE:
+      Serial.print("[CLOUD -> DEVICE] ");
+      break;
+    case FROM_CLOUD:
+      Serial.print("[CLOUD -> PROXY] ");
+      break;
+    case TO_DEVICE:
+      Serial.print("[PROXY -> DEVICE] ");
+      break;
+    case TO_CLOUD:
+      Serial.print("[PROXY -> CLOUD] ");
+      break;
+    default:
+      Serial.print("[UNKNOWN] ");
+      break;
+  }
+}
@@ -0,0 +1,63 @@
+#include "MemoryUtil.h"
+#include "config.h"
+
+#ifdef ARDUINO
+
+#include <esp_heap_caps.h>
+
+void* allocInternal(size_t size) {
+  return heap_caps_malloc(size, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+}
+
+void* allocBulk(size_t size, bool& inPsram) {
+  #if FORWARD_BUFFER_PSRAM
+    if (psramFound()) {
+      void* memory = heap_caps_malloc(size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+      if (memory) {
+        inPsram = true;
+        return memory;
+      }
+    }
+  #endif
+  inPsram = false;
+  return allocInternal(size);
+}
+
+void freeMemory(void* memory) {
+  heap_caps_free(memory);
+}
+
+uint32_t psramSize() {
+  return ESP.getPsramSize();
+}
+
+uint32_t psramFree() {
+  return ESP.getFreePsram();
+}
+
+#else
+
+#include <stdlib.h>
+
+void* allocInternal(size_t size) {
+  return malloc(size);
+}
+
+void* allocBulk(size_t size, bool& inPsram) {
+  inPsram = false;
+  return malloc(size);
+}
+
+void freeMemory(void* memory) {
+  free(memory);
+}
+
+uint32_t psramSize() {
+  return 0;
+}
+
+uint32_t psramFree() {
+  return 0;
+}
+
+#endif
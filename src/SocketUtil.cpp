@@ -0,0 +1,183 @@
+#include "SocketUtil.h"
+#include <errno.h>
+
+// On a host, a send to a peer that reset the connection raises SIGPIPE, which ends
+// the program: ask for the error instead (macOS has no flag, see socketConnectStart())
+#if !defined(ARDUINO) && defined(MSG_NOSIGNAL)
+  #define SEND_FLAGS (MSG_DONTWAIT | MSG_NOSIGNAL)
+#else
+  #define SEND_FLAGS MSG_DONTWAIT
+#endif
+
+int socketConnectStart(const IPAddress& ip, uint16_t port, const SocketProfile& profile) {
+  int fd = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+  if (fd < 0) return -1;
+
+  // Non-blocking: connect() returns immediately with EINPROGRESS
+  fcntl(fd, F_SETFL, fcntl(fd, F_GETFL, 0) | O_NONBLOCK);
+  socketApplyProfile(fd, profile);
+  #if !defined(ARDUINO) && defined(SO_NOSIGPIPE)
+    int noSigPipe = 1;
+    setsockopt(fd, SOL_SOCKET, SO_NOSIGPIPE, &noSigPipe, sizeof(noSigPipe));
+  #endif
+
+  struct sockaddr_in addr;
+  memset(&addr, 0, sizeof(addr));
+  addr.sin_family = AF_INET;
+  addr.sin_port = htons(port);
+  addr.sin_addr.s_addr = (uint32_t)ip;
+
+  int res = connect(fd, (struct sockaddr*)&addr, sizeof(addr));
+  if (res < 0 && errno != EINPROGRESS) {
+    close(fd);
+    return -1;
+  }
+  return fd;
+}
+
+void socketApplyProfile(int fd, const SocketProfile& profile) {
+  int value = profile.noDelay ? 1 : 0;
+  setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &value, sizeof(value));
+  
+  value = profile.keepAliveIdle > 0 ? 1 : 0;
+  setsockopt(fd, SOL_SOCKET, SO_KEEPALIVE, &value, sizeof(value));
+  if (profile.keepAliveIdle > 0) {
+    value = profile.keepAliveIdle;
+    setsockopt(fd, IPPROTO_TCP, TCP_KEEPIDLE, &value, sizeof(value));
+    value = max(profile.keepAliveInterval, (uint16_t)1);
+    setsockopt(fd, IPPROTO_TCP, TCP_KEEPINTVL, &value, sizeof(value));
+    value = max(profile.keepAliveCount, (uint16_t)1);
+    setsockopt(fd, IPPROTO_TCP, TCP_KEEPCNT, &value, sizeof(value));
+  }
+  
+  // lwIP has one send buffer size for all sockets (TCP_SND_BUF) and may refuse this
+  if (profile.sendBuffer > 0) {
+    value = profile.sendBuffer;
+    setsockopt(fd, SOL_SOCKET, SO_SNDBUF, &value, sizeof(value));
+  }
+}
+
+int socketConnectCheck(int fd) {
+  fd_set writeSet;
+  FD_ZERO(&writeSet);
+  FD_SET(fd, &writeSet);
+  struct timeval timeout = { 0, 0 };
+
+  int res = select(fd + 1, nullptr, &writeSet, nullptr, &timeout);
+  if (res < 0) return -1;
+  if (res == 0) return 0;
+
+  // Writable: the connect finished, SO_ERROR tells us whether it succeeded
+  int err = 0;
+  socklen_t errLen = sizeof(err);
+  if (getsockopt(fd, SOL_SOCKET, SO_ERROR, &err, &errLen) < 0 || err != 0) {
+    return -1;
+  }
+  return 1;
+}
+
+int socketSend(int fd, const uint8_t* data, size_t len) {
+  int res = send(fd, data, len, SEND_FLAGS);
+  if (res < 0) {
+    return (errno == EAGAIN || errno == EWOULDBLOCK) ? 0 : -1;
+  }
+  return res;
+}
+
+int socketSend(int fd, const uint8_t* data1, size_t len1, const uint8_t* data2, size_t len2) {
+  if (len2 == 0) return socketSend(fd, data1, len1);
+  
+  struct iovec parts[2];
+  parts[0].iov_base = (void*)data1;
+  parts[0].iov_len = len1;
+  parts[1].iov_base = (void*)data2;
+  parts[1].iov_len = len2;
+  
+  struct msghdr msg;
+  memset(&msg, 0, sizeof(msg));
+  msg.msg_iov = parts;
+  msg.msg_iovlen = 2;
+  
+  int res = sendmsg(fd, &msg, SEND_FLAGS);
+  if (res < 0) {
+    return (errno == EAGAIN || errno == EWOULDBLOCK) ? 0 : -1;
+  }
+  return res;
+}
+
+int socketRecv(int fd, uint8_t* data, size_t len) {
+  int res = recv(fd, data, len, MSG_DONTWAIT);
+  if (res == 0) return -1;  // orderly close by the peer
+  if (res < 0) {
+    return (errno == EAGAIN || errno == EWOULDBLOCK) ? 0 : -1;
+  }
+  return res;
+}
+
+int socketRecv(int fd, uint8_t* data1, size_t len1, uint8_t* data2, size_t len2) {
+  if (len2 == 0) return socketRecv(fd, data1, len1);
+  
+  struct iovec parts[2];
+  parts[0].iov_base = data1;
+  parts[0].iov_len = len1;
+  parts[1].iov_base = data2;
+  parts[1].iov_len = len2;
+  
+  struct msghdr msg;
+  memset(&msg, 0, sizeof(msg));
+  msg.msg_iov = parts;
+  msg.msg_iovlen = 2;
+  
+  int res = recvmsg(fd, &msg, MSG_DONTWAIT);
+  if (res == 0) return -1;  // orderly close by the peer
+  if (res < 0) {
+    return (errno == EAGAIN || errno == EWOULDBLOCK) ? 0 : -1;
+  }
+  return res;
+}
+
+void socketClose(int fd) {
+  if (fd >= 0) close(fd);
+}
+
+///////////////
+// SocketSet //
+///////////////
+
+void SocketSet::clear() {
+  FD_ZERO(&this->watchedRead);
+  FD_ZERO(&this->watchedWrite);
+  FD_ZERO(&this->readyRead);
+  FD_ZERO(&this->readyWrite);
+  this->maxFd = -1;
+}
+
+void SocketSet::watchRead(int fd) {
+  if (fd < 0) return;
+  FD_SET(fd, &this->watchedRead);
+  if (fd > this->maxFd) this->maxFd = fd;
+}
+
+void SocketSet::watchWrite(int fd) {
+  if (fd < 0) return;
+  FD_SET(fd, &this->watchedWrite);
+  if (fd > this->maxFd) this->maxFd = fd;
+}
+
+int SocketSet::wait(unsigned long timeoutMs) {
+  this->readyRead = this->watchedRead;
+  this->readyWrite = this->watchedWrite;
+  
+  struct timeval timeout;
+  timeout.tv_sec = timeoutMs / 1000;
+  timeout.tv_usec = (timeoutMs % 1000) * 1000;
+  
+  int res = select(this->maxFd + 1, &this->readyRead, &this->readyWrite, nullptr, &timeout);
+  if (res < 0) {
+    // Should not happen (all fds are open), but if it does, report everything
+    // as ready: the non-blocking reads and writes will find out what is going on
+    this->readyRead = this->watchedRead;
+    this->readyWrite = this->watchedWrite;
+  }
+  return res;
+}
@@ -0,0 +1,69 @@
+#include "TaskUtil.h"
+
+#ifdef ARDUINO
+
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <esp_task_wdt.h>
+
+bool startTask(TaskMain taskMain, const char* name, uint32_t stackSize, void* arg, int priority, int core) {
+  return xTaskCreatePinnedToCore(taskMain, name, stackSize, arg, priority, nullptr, core) == pdPASS;
+}
+
+void taskSleep(unsigned long ms) {
+  vTaskDelay(pdMS_TO_TICKS(ms));
+}
+
+void watchdogAdd(uint32_t timeoutSeconds) {
+  // Already running (started by the core), this only changes its timeout and makes it restart
+  esp_task_wdt_init(timeoutSeconds, true);
+  esp_task_wdt_add(nullptr);
+}
+
+void watchdogFeed() {
+  esp_task_wdt_reset();
+}
+
+#else
+
+#include <pthread.h>
+#include <time.h>
+
+struct TaskStart {
+  TaskMain taskMain;
+  void* arg;
+};
+
+static void* runTask(void* param) {
+  TaskStart start = *(TaskStart*)param;
+  delete (TaskStart*)param;
+  start.taskMain(start.arg);
+  return nullptr;
+}
+
+bool startTask(TaskMain taskMain, const char* name, uint32_t stackSize, void* arg, int priority, int core) {
+  TaskStart* start = new TaskStart();
+  start->taskMain = taskMain;
+  start->arg = arg;
+  
+  pthread_t thread;
+  if (pthread_create(&thread, nullptr, runTask, start) != 0) {
+    delete start;
+    return false;
+  }
+  pthread_detach(thread);
+  return true;
+}
+
+void taskSleep(unsigned long ms) {
+  struct timespec delay = { (time_t)(ms / 1000), (long)(ms % 1000) * 1000000L };
+  nanosleep(&delay, nullptr);
+}
+
+void watchdogAdd(uint32_t timeoutSeconds) {
+}
+
+void watchdogFeed() {
+}
+
+#endif
@@ -1,9 +1,19 @@
 #include "WebConfig.h"
 #include "config.h"
-#include "ConfigPage.h"
+#include "WebAssets.h"
+#include "TaskUtil.h"
+
+// Socket options from config.h, used until they are changed in the web interface
+static const SocketProfile CLOUD_SOCKET_DEFAULTS = {
+  CLOUD_TCP_NODELAY, CLOUD_KEEPALIVE_IDLE, CLOUD_KEEPALIVE_INTERVAL, CLOUD_KEEPALIVE_COUNT, CLOUD_SEND_BUFFER
+};
+static const SocketProfile DEVICE_SOCKET_DEFAULTS = {
+  DEVICE_TCP_NODELAY, DEVICE_KEEPALIVE_IDLE, DEVICE_KEEPALIVE_INTERVAL, DEVICE_KEEPALIVE_COUNT, DEVICE_SEND_BUFFER
+};
 
 WebConfig::WebConfig(ESPProxy* proxy) {
   this->proxy = proxy;
+  this->server = nullptr;
   this->preferences.begin("duotecno", false);
   // Note: loadConfig() is called separately in main.cpp with ProxyConfig parameter
 }
@@ -27,11 +37,17 @@ bool WebConfig::begin() {
   
   // Set up routes
   this->server->on("/", [this]() { this->handleRoot(); });
+  this->server->on("/config", HTTP_GET, [this]() { this->handleConfig(); });
   this->server->on("/status", HTTP_GET, [this]() { this->handleStatus(); });
+  this->server->on("/metrics", HTTP_GET, [this]() { this->handleMetrics(); });
   this->server->on("/save", HTTP_POST, [this]() { this->handleSave(); });
   this->server->on("/restart", HTTP_POST, [this]() { this->handleRestart(); });
   this->server->onNotFound([this]() { this->handleNotFound(); });
   
+  // The browser's cached copy of a page is checked against our ETag
+  static const char* headers[] = { "If-None-Match" };
+  this->server->collectHeaders(headers, 1);
+  
   // Start server
   this->server->begin();
   Serial.print("[WEB] http server started on port ");
@@ -53,6 +69,23 @@ bool WebConfig::begin() {
   return true;
 }
 
+bool WebConfig::start() {
+  // Web server gets the other core, slow pages never delay the proxy task
+  if (!startTask(WebConfig::webTask, "web", WEB_TASK_STACK, this, WEB_TASK_PRIORITY, WEB_TASK_CORE)) {
+    Serial.println("[WEB] Failed to start web task");
+    return false;
+  }
+  return true;
+}
+
+void WebConfig::webTask(void* arg) {
+  WebConfig* webConfig = (WebConfig*)arg;
+  for (;;) {
+    webConfig->loop();
+    taskSleep(2);
+  }
+}
+
 void WebConfig::loop() {
   if (this->server) {
     this->server->handleClient();
@@ -83,22 +116,66 @@ bool WebConfig::loadConfig(ProxyConfig& config) {
   Serial.print("[CONFIG] === cloudPort: ");
   Serial.println(config.cloudPort);
   
-  this->loadStringParameter("masterAddr", config.masterAddress, sizeof(config.masterAddress), MASTER_ADDRESS);
+  // Route 0, the main master, keeps the keys from before there were routes
+  RouteConfig& master = config.routes[0];
+  this->loadStringParameter("masterAddr", master.masterAddress, sizeof(master.masterAddress), MASTER_ADDRESS);
   Serial.print("[CONFIG] === masterAddress: ");
-  Serial.println(config.masterAddress);
+  Serial.println(master.masterAddress);
   
-  this->loadUShortParameter("masterPort", config.masterPort, MASTER_PORT);
+  this->loadUShortParameter("masterPort", master.masterPort, MASTER_PORT);
   Serial.print("[CONFIG] === masterPort: ");
-  Serial.println(config.masterPort);
+  Serial.println(master.masterPort);
   
-  this->loadStringParameter("uniqueId", config.uniqueId, sizeof(config.uniqueId), UNIQUE_ID);
+  this->loadStringParameter("uniqueId", master.uniqueId, sizeof(master.uniqueId), UNIQUE_ID);
   Serial.print("[CONFIG] === uniqueId: ");
-  Serial.println(config.uniqueId);
+  Serial.println(master.uniqueId);
+  
+  // Additional masters: route<n>Id, route<n>Addr, route<n>Port - skipped when they have no unique ID
+  config.routeCount = 1;
+  for (int r = 1; r < MAX_ROUTES; r++) {
+    RouteConfig& route = config.routes[config.routeCount];
+    char key[16];
+    snprintf(key, sizeof(key), "route%dId", r);
+    this->loadStringParameter(key, route.uniqueId, sizeof(route.uniqueId), "");
+    snprintf(key, sizeof(key), "route%dAddr", r);
+    this->loadStringParameter(key, route.masterAddress, sizeof(route.masterAddress), "");
+    snprintf(key, sizeof(key), "route%dPort", r);
+    this->loadUShortParameter(key, route.masterPort, MASTER_PORT);
+    if (strlen(route.uniqueId) == 0) continue;
+    
+    Serial.printf("[CONFIG] === route %d: %s -> %s:%u\n", config.routeCount,
+                  route.uniqueId, route.masterAddress, route.masterPort);
+    config.routeCount++;
+  }
   
   this->loadBoolParameter("debug", config.debug, DEBUG_MODE);
   Serial.print("[CONFIG] === debug: ");
   Serial.println(config.debug ? "true" : "false");
   
+  this->loadUShortParameter("capacity", config.capacity, CONNECTION_CAPACITY);
+  Serial.print("[CONFIG] === capacity: ");
+  Serial.println(config.capacity);
+  
+  this->loadUShortParameter("bufferSize", config.bufferSize, FORWARD_BUFFER_SIZE);
+  Serial.print("[CONFIG] === bufferSize: ");
+  Serial.println(config.bufferSize);
+  
+  this->loadUShortParameter("poolMinFree", config.poolMinFree, POOL_MIN_FREE);
+  Serial.print("[CONFIG] === poolMinFree: ");
+  Serial.println(config.poolMinFree);
+  
+  this->loadUShortParameter("poolMaxFree", config.poolMaxFree, POOL_MAX_FREE);
+  Serial.print("[CONFIG] === poolMaxFree: ");
+  Serial.println(config.poolMaxFree);
+  
+  this->loadUShortParameter("preconnect", config.preconnect, DEVICE_PRECONNECT_BUDGET);
+  Serial.print("[CONFIG] === preconnect: ");
+  Serial.println(config.preconnect);
+  
+  // Socket options: cloud<Option> and dev<Option>, see loadSocketProfile()
+  this->loadSocketProfile("cloud", config.cloudSocket, CLOUD_SOCKET_DEFAULTS);
+  this->loadSocketProfile("dev", config.deviceSocket, DEVICE_SOCKET_DEFAULTS);
+  
   // Load network configuration from NVRAM with config.h defaults
   this->loadBoolParameter("useDHCP", config.useDHCP, USE_DHCP);
   Serial.print("[CONFIG] === useDHCP: ");
@@ -128,10 +205,32 @@ bool WebConfig::saveConfig(const ProxyConfig& config, const String& mdnsHostname
   
   this->preferences.putString("cloudServer", config.cloudServer);
   this->preferences.putUShort("cloudPort", config.cloudPort);
-  this->preferences.putString("masterAddr", config.masterAddress);
-  this->preferences.putUShort("masterPort", config.masterPort);
-  this->preferences.putString("uniqueId", config.uniqueId);
+  this->preferences.putString("masterAddr", config.routes[0].masterAddress);
+  this->preferences.putUShort("masterPort", config.routes[0].masterPort);
+  this->preferences.putString("uniqueId", config.routes[0].uniqueId);
+  for (int r = 1; r < MAX_ROUTES; r++) {
+    char idKey[16], addrKey[16], portKey[16];
+    snprintf(idKey, sizeof(idKey), "route%dId", r);
+    snprintf(addrKey, sizeof(addrKey), "route%dAddr", r);
+    snprintf(portKey, sizeof(portKey), "route%dPort", r);
+    if (r < config.routeCount) {
+      this->preferences.putString(idKey, config.routes[r].uniqueId);
+      this->preferences.putString(addrKey, config.routes[r].masterAddress);
+      this->preferences.putUShort(portKey, config.routes[r].masterPort);
+    } else {
+      this->preferences.remove(idKey);
+      this->preferences.remove(addrKey);
+      this->preferences.remove(portKey);
+    }
+  }
   this->preferences.putBool("debug", config.debug);
+  this->preferences.putUShort("capacity", config.capacity);
+  this->preferences.putUShort("bufferSize", config.bufferSize);
+  this->preferences.putUShort("poolMinFree", config.poolMinFree);
+  this->preferences.putUShort("poolMaxFree", config.poolMaxFree);
+  this->preferences.putUShort("preconnect", config.preconnect);
+  this->saveSocketProfile("cloud", config.cloudSocket);
+  this->saveSocketProfile("dev", config.deviceSocket);
   this->preferences.putString("mdnsHostname", mdnsHostname);
   
   // Save network configuration
@@ -175,20 +274,242 @@ void WebConfig::loadBoolParameter(const char* key, bool& value, bool defaultValu
   }
 }
 
+// Keys and form fields of a socket profile: <prefix>NoDelay, <prefix>KaIdle, <prefix>KaIntvl, <prefix>KaCount, <prefix>SndBuf
+void WebConfig::loadSocketProfile(const char* prefix, SocketProfile& profile, const SocketProfile& defaults) {
+  char key[16];
+  snprintf(key, sizeof(key), "%sNoDelay", prefix);
+  this->loadBoolParameter(key, profile.noDelay, defaults.noDelay);
+  snprintf(key, sizeof(key), "%sKaIdle", prefix);
+  this->loadUShortParameter(key, profile.keepAliveIdle, defaults.keepAliveIdle);
+  snprintf(key, sizeof(key), "%sKaIntvl", prefix);
+  this->loadUShortParameter(key, profile.keepAliveInterval, defaults.keepAliveInterval);
+  snprintf(key, sizeof(key), "%sKaCount", prefix);
+  this->loadUShortParameter(key, profile.keepAliveCount, defaults.keepAliveCount);
+  snprintf(key, sizeof(key), "%sSndBuf", prefix);
+  this->loadUShortParameter(key, profile.sendBuffer, defaults.sendBuffer);
+  
+  Serial.printf("[CONFIG] === %s sockets: nodelay %s, keepalive %u/%u/%u, sndbuf %u\n", prefix,
+                profile.noDelay ? "true" : "false", profile.keepAliveIdle, profile.keepAliveInterval,
+                profile.keepAliveCount, profile.sendBuffer);
+}
+
+void WebConfig::saveSocketProfile(const char* prefix, const SocketProfile& profile) {
+  char key[16];
+  snprintf(key, sizeof(key), "%sNoDelay", prefix);
+  this->preferences.putBool(key, profile.noDelay);
+  snprintf(key, sizeof(key), "%sKaIdle", prefix);
+  this->preferences.putUShort(key, profile.keepAliveIdle);
+  snprintf(key, sizeof(key), "%sKaIntvl", prefix);
+  this->preferences.putUShort(key, profile.keepAliveInterval);
+  snprintf(key, sizeof(key), "%sKaCount", prefix);
+  this->preferences.putUShort(key, profile.keepAliveCount);
+  snprintf(key, sizeof(key), "%sSndBuf", prefix);
+  this->preferences.putUShort(key, profile.sendBuffer);
+}
+
+void WebConfig::readSocketProfile(const char* prefix, SocketProfile& profile, const SocketProfile& defaults) {
+  char name[16];
+  profile = defaults;
+  
+  // Checkbox: present in POST = checked
+  snprintf(name, sizeof(name), "%sNoDelay", prefix);
+  profile.noDelay = this->server->hasArg(name);
+  snprintf(name, sizeof(name), "%sKaIdle", prefix);
+  if (this->server->hasArg(name)) profile.keepAliveIdle = constrain(this->server->arg(name).toInt(), 0, 7200);
+  snprintf(name, sizeof(name), "%sKaIntvl", prefix);
+  if (this->server->hasArg(name)) profile.keepAliveInterval = constrain(this->server->arg(name).toInt(), 1, 600);
+  snprintf(name, sizeof(name), "%sKaCount", prefix);
+  if (this->server->hasArg(name)) profile.keepAliveCount = constrain(this->server->arg(name).toInt(), 1, 20);
+  snprintf(name, sizeof(name), "%sSndBuf", prefix);
+  if (this->server->hasArg(name)) profile.sendBuffer = constrain(this->server->arg(name).toInt(), 0, 65535);
+}
+
 void WebConfig::handleRoot() {
-  String html = this->generateHTML();
   if (this->proxy && this->proxy->getConfig().debug) {
     Serial.println("[WEB] Serving configuration page");
   }
- this->server->send(200, "text/html", html);
+  this->sendPage(INDEX_HTML_GZ, INDEX_HTML_GZ_LEN, INDEX_HTML_ETAG);
+}
+
+void WebConfig::sendPage(const uint8_t* gz, size_t len, const char* etag) {
+  // Pages only change with the firmware: a browser that has this one gets a 304,
+  // "no-cache" makes it ask every time, so a new firmware is never hidden
+  this->server->sendHeader("ETag", etag);
+  this->server->sendHeader("Cache-Control", "no-cache");
+  if (this->server->hasHeader("If-None-Match") && this->server->header("If-None-Match") == etag) {
+    this->server->send(304);
+    return;
+  }
+  
+  // Sent from flash as is, the browser unzips
+  this->server->sendHeader("Content-Encoding", "gzip");
+  this->server->send_P(200, "text/html", (PGM_P)gz, len);
 }
 
 void WebConfig::handleStatus() {
-  String json = this->generateStatusJSON();
   if (this->proxy && this->proxy->getConfig().debug) {
     Serial.println("[WEB] Serving status JSON");
   }
-  this->server->send(200, "application/json", json);
+  
+  // Polled by every open status page: streamed, no Strings
+  ChunkedWriter out(this->server);
+  out.begin("application/json");
+  this->writeStatusJSON(out);
+  out.end();
+}
+
+// Prometheus text exposition format: HELP and TYPE, then the sample(s)
+static void metricHeader(ChunkedWriter& out, const char* name, const char* type, const char* help) {
+  out.print("# HELP ");
+  out.print(name);
+  out.print(' ');
+  out.print(help);
+  out.print("\n# TYPE ");
+  out.print(name);
+  out.print(' ');
+  out.print(type);
+  out.print('\n');
+}
+
+static void metricSample(ChunkedWriter& out, const char* name, const char* labels, uint64_t value) {
+  out.print(name);
+  if (labels) {
+    out.print('{');
+    out.print(labels);
+    out.print('}');
+  }
+  out.print(' ');
+  out.print(value);
+  out.print('\n');
+}
+
+static void metric(ChunkedWriter& out, const char* name, const char* type, const char* help, uint64_t value) {
+  metricHeader(out, name, type, help);
+  metricSample(out, name, nullptr, value);
+}
+
+// One set of labels of a summary: its quantiles, _sum and _count (us -> seconds)
+static void summaryMetric(ChunkedWriter& out, const char* name, const char* labels, const LatencySummary& latency) {
+  out.printf("%s{%s,quantile=\"0.5\"} %.6f\n", name, labels, latency.p50 / 1e6);
+  out.printf("%s{%s,quantile=\"0.9\"} %.6f\n", name, labels, latency.p90 / 1e6);
+  out.printf("%s{%s,quantile=\"0.99\"} %.6f\n", name, labels, latency.p99 / 1e6);
+  out.printf("%s{%s,quantile=\"1\"} %.6f\n", name, labels, latency.max / 1e6);
+  out.printf("%s_sum{%s} %.6f\n", name, labels, latency.sum / 1e6);
+  out.printf("%s_count{%s} %u\n", name, labels, (unsigned)latency.count);
+}
+
+void WebConfig::handleMetrics() {
+  this->readStatus();
+  const ProxyStatus& status = this->status;
+  
+  // Written straight into the response, a chunk at a time
+  ChunkedWriter out(this->server);
+  out.begin("text/plain; version=0.0.4");
+  
+  metricHeader(out, "espproxy_connections", "gauge", "Cloud connections by state");
+  metricSample(out, "espproxy_connections", "state=\"free\"", status.freeConnections);
+  metricSample(out, "espproxy_connections", "state=\"active\"", status.activeConnections);
+  metric(out, "espproxy_connections_max", "gauge", "Connection slots allocated at startup", status.capacity);
+  metric(out, "espproxy_pool_target", "gauge", "Free connections the warm pool aims for", status.poolTarget);
+  metric(out, "espproxy_pool_hits_total", "counter", "Clients that left another free connection ready", status.poolHits);
+  metric(out, "espproxy_pool_misses_total", "counter", "Clients that took the last free connection", status.poolMisses);
+  metricHeader(out, "espproxy_client_arrival_rate", "gauge", "Clients per second (moving average)");
+  out.printf("espproxy_client_arrival_rate %.3f\n", status.arrivalRate);
+  metric(out, "espproxy_client_connections_total", "counter", "Clients handled since boot", status.clientConnections);
+  
+  // Per master, labeled with the index of its route (the unique IDs are in /status)
+  char labels[48];
+  metricHeader(out, "espproxy_route_connections", "gauge", "Cloud connections per master by state");
+  for (int r = 0; r < status.routeCount; r++) {
+    snprintf(labels, sizeof(labels), "route=\"%d\",state=\"free\"", r);
+    metricSample(out, "espproxy_route_connections", labels, status.routes[r].freeConnections);
+    snprintf(labels, sizeof(labels), "route=\"%d\",state=\"active\"", r);
+    metricSample(out, "espproxy_route_connections", labels, status.routes[r].activeConnections);
+  }
+  metricHeader(out, "espproxy_route_client_connections_total", "counter", "Clients handled per master since boot");
+  for (int r = 0; r < status.routeCount; r++) {
+    snprintf(labels, sizeof(labels), "route=\"%d\"", r);
+    metricSample(out, "espproxy_route_client_connections_total", labels, status.routes[r].clientConnections);
+  }
+  metricHeader(out, "espproxy_route_pool_misses_total", "counter", "Clients that took the last free connection of their master");
+  for (int r = 0; r < status.routeCount; r++) {
+    snprintf(labels, sizeof(labels), "route=\"%d\"", r);
+    metricSample(out, "espproxy_route_pool_misses_total", labels, status.routes[r].poolMisses);
+  }
+  metricHeader(out, "espproxy_route_forwarded_bytes_total", "counter", "Bytes forwarded per master");
+  for (int r = 0; r < status.routeCount; r++) {
+    snprintf(labels, sizeof(labels), "route=\"%d\",direction=\"to_device\"", r);
+    metricSample(out, "espproxy_route_forwarded_bytes_total", labels, status.routes[r].toDevice.bytes);
+    snprintf(labels, sizeof(labels), "route=\"%d\",direction=\"to_cloud\"", r);
+    metricSample(out, "espproxy_route_forwarded_bytes_total", labels, status.routes[r].toCloud.bytes);
+  }
+  
+  metricHeader(out, "espproxy_forwarded_bytes_total", "counter", "Bytes forwarded");
+  metricSample(out, "espproxy_forwarded_bytes_total", "direction=\"to_device\"", status.toDevice.bytes);
+  metricSample(out, "espproxy_forwarded_bytes_total", "direction=\"to_cloud\"", status.toCloud.bytes);
+  metricHeader(out, "espproxy_forwarded_chunks_total", "counter", "Reads forwarded");
+  metricSample(out, "espproxy_forwarded_chunks_total", "direction=\"to_device\"", status.toDevice.chunks);
+  metricSample(out, "espproxy_forwarded_chunks_total", "direction=\"to_cloud\"", status.toCloud.chunks);
+  metricHeader(out, "espproxy_forward_latency_seconds", "summary", "Time data waits in the proxy, since boot");
+  summaryMetric(out, "espproxy_forward_latency_seconds", "direction=\"to_device\"", status.latencyToDevice);
+  summaryMetric(out, "espproxy_forward_latency_seconds", "direction=\"to_cloud\"", status.latencyToCloud);
+  
+  metricHeader(out, "espproxy_forward_cpu_seconds_total", "counter", "Time spent in the receive/send calls that forward data");
+  out.printf("espproxy_forward_cpu_seconds_total %.6f\n", status.forwardMicros / 1e6);
+  metricHeader(out, "espproxy_forward_calls_total", "counter", "Receive/send calls that forward data");
+  metricSample(out, "espproxy_forward_calls_total", "op=\"recv\"", status.forwardRecvCalls);
+  metricSample(out, "espproxy_forward_calls_total", "op=\"send\"", status.forwardSendCalls);
+  metric(out, "espproxy_forward_direct_recv", "gauge", "Data received straight into the forwarding buffers (FORWARD_DIRECT_RECV)", FORWARD_DIRECT_RECV ? 1 : 0);
+  
+  metric(out, "espproxy_preconnect_budget", "gauge", "Free connections allowed to hold a pre-connected master socket", status.preconnectBudget);
+  metric(out, "espproxy_preconnect_open", "gauge", "Free connections holding a pre-connected master socket", status.preconnectOpen);
+  metric(out, "espproxy_preconnect_started_total", "counter", "Master pre-connects started", status.preconnectStarted);
+  metric(out, "espproxy_preconnect_used_total", "counter", "Clients that got a pre-connected master socket", status.preconnectUsed);
+  metric(out, "espproxy_preconnect_dropped_total", "counter", "Master pre-connects that failed or were closed by the master", status.preconnectDropped);
+  metricHeader(out, "espproxy_first_byte_seconds", "summary", "First client data to its first byte sent to the master, since boot");
+  summaryMetric(out, "espproxy_first_byte_seconds", "preconnect=\"yes\"", status.ttfbWarm);
+  summaryMetric(out, "espproxy_first_byte_seconds", "preconnect=\"no\"", status.ttfbCold);
+  
+  metric(out, "espproxy_cloud_connect_attempts_total", "counter", "Cloud connections started", status.cloudAttempts);
+  metric(out, "espproxy_cloud_connect_failures_total", "counter", "Cloud connections that failed", status.cloudFailures);
+  metricHeader(out, "espproxy_dns_cache_total", "counter", "Cloud server address taken from the DNS cache, by result");
+  metricSample(out, "espproxy_dns_cache_total", "result=\"hit\"", status.dnsHits);
+  metricSample(out, "espproxy_dns_cache_total", "result=\"miss\"", status.dnsMisses);
+  metricSample(out, "espproxy_dns_cache_total", "result=\"stale\"", status.dnsStale);
+  metric(out, "espproxy_dns_lookups_total", "counter", "DNS lookups of the cloud server", status.dnsLookups);
+  metric(out, "espproxy_dns_lookup_failures_total", "counter", "DNS lookups that failed or timed out", status.dnsFailures);
+  metricHeader(out, "espproxy_timeouts_total", "counter", "Connections closed because their peer went silent");
+  metricSample(out, "espproxy_timeouts_total", "kind=\"connect\"", status.connectTimeouts);
+  metricSample(out, "espproxy_timeouts_total", "kind=\"heartbeat\"", status.heartbeatTimeouts);
+  metricSample(out, "espproxy_timeouts_total", "kind=\"idle\"", status.idleTimeouts);
+  metric(out, "espproxy_outages_total", "counter", "Times all connections were lost (rebuilt without a restart)", status.outages);
+  metricHeader(out, "espproxy_outage_seconds", "gauge", "Duration of the current outage, 0 if there is none");
+  out.printf("espproxy_outage_seconds %.3f\n", status.outageMs / 1000.0);
+  metricHeader(out, "espproxy_recovery_seconds", "gauge", "Time to recover from an outage: last and longest");
+  out.printf("espproxy_recovery_seconds{outage=\"last\"} %.3f\n", status.lastRecoveryMs / 1000.0);
+  out.printf("espproxy_recovery_seconds{outage=\"max\"} %.3f\n", status.maxRecoveryMs / 1000.0);
+  metricHeader(out, "espproxy_recovery_seconds_total", "counter", "Time spent recovering from outages");
+  out.printf("espproxy_recovery_seconds_total %.3f\n", status.totalRecoveryMs / 1000.0);
+  metric(out, "espproxy_cloud_connect_state", "gauge", "State of the cloud connection being set up (0 = idle)", status.cloudState);
+  
+  metric(out, "espproxy_heap_free_bytes", "gauge", "Free heap", status.freeHeap);
+  metric(out, "espproxy_heap_min_free_bytes", "gauge", "Lowest free heap since boot", status.minFreeHeap);
+  metric(out, "espproxy_heap_largest_free_block_bytes", "gauge", "Largest free heap block", status.largestFreeBlock);
+  metric(out, "espproxy_heap_min_largest_free_block_bytes", "gauge", "Lowest largest free heap block since boot", status.minLargestFreeBlock);
+  metric(out, "espproxy_psram_size_bytes", "gauge", "PSRAM of the board (0 = none)", status.psramSize);
+  metric(out, "espproxy_psram_free_bytes", "gauge", "Free PSRAM", status.psramFree);
+  metricHeader(out, "espproxy_slot_bytes", "gauge", "Memory per connection slot: context (internal RAM) and forwarding buffers");
+  metricSample(out, "espproxy_slot_bytes", "part=\"context\"", status.slotBytes);
+  metricSample(out, "espproxy_slot_bytes", status.buffersInPsram ? "part=\"buffers\",memory=\"psram\"" : "part=\"buffers\",memory=\"internal\"",
+               status.slotBufferBytes);
+  metric(out, "espproxy_log_dropped_total", "counter", "Log messages dropped", status.logDropped);
+  
+  metric(out, "espproxy_eth_link_up", "gauge", "Ethernet link up", ETH.linkUp() ? 1 : 0);
+  metric(out, "espproxy_eth_link_speed_mbps", "gauge", "Ethernet link speed", ETH.linkSpeed());
+  metric(out, "espproxy_eth_full_duplex", "gauge", "Ethernet link is full duplex", ETH.fullDuplex() ? 1 : 0);
+  metric(out, "espproxy_uptime_seconds", "gauge", "Time since boot", millis() / 1000);
+  
+  out.end();
 }
 
 void WebConfig::handleSave() {
@@ -204,18 +525,64 @@ void WebConfig::handleSave() {
   if (this->server->hasArg("cloudPort")) {
     newConfig.cloudPort = this->server->arg("cloudPort").toInt();
   }
+  
+  // Main master (route 0), then the additional ones: route<n>Id, route<n>Addr, route<n>Port
+  memset(newConfig.routes, 0, sizeof(newConfig.routes));
+  RouteConfig& master = newConfig.routes[0];
+  master.masterPort = MASTER_PORT;
   if (this->server->hasArg("masterAddress")) {
-    strncpy(newConfig.masterAddress, this->server->arg("masterAddress").c_str(), sizeof(newConfig.masterAddress) - 1);
+    strncpy(master.masterAddress, this->server->arg("masterAddress").c_str(), sizeof(master.masterAddress) - 1);
   }
   if (this->server->hasArg("masterPort")) {
-    newConfig.masterPort = this->server->arg("masterPort").toInt();
+    master.masterPort = this->server->arg("masterPort").toInt();
   }
   if (this->server->hasArg("uniqueId")) {
-    strncpy(newConfig.uniqueId, this->server->arg("uniqueId").c_str(), sizeof(newConfig.uniqueId) - 1);
+    strncpy(master.uniqueId, this->server->arg("uniqueId").c_str(), sizeof(master.uniqueId) - 1);
+  }
+  newConfig.routeCount = 1;
+  for (int r = 1; r < MAX_ROUTES; r++) {
+    char name[16];
+    snprintf(name, sizeof(name), "route%dId", r);
+    String uniqueId = this->server->arg(name);
+    uniqueId.trim();
+    if (uniqueId.length() == 0) continue;  // empty row: no route
+    
+    RouteConfig& route = newConfig.routes[newConfig.routeCount++];
+    strncpy(route.uniqueId, uniqueId.c_str(), sizeof(route.uniqueId) - 1);
+    snprintf(name, sizeof(name), "route%dAddr", r);
+    strncpy(route.masterAddress, this->server->arg(name).c_str(), sizeof(route.masterAddress) - 1);
+    snprintf(name, sizeof(name), "route%dPort", r);
+    route.masterPort = this->server->hasArg(name) ? this->server->arg(name).toInt() : MASTER_PORT;
   }
   // Checkbox: present in POST = checked (true), absent = unchecked (false)
   newConfig.debug = this->server->hasArg("debug");
   
+  // Connection slots, used after the next restart
+  newConfig.capacity = CONNECTION_CAPACITY;
+  newConfig.bufferSize = FORWARD_BUFFER_SIZE;
+  if (this->server->hasArg("capacity")) {
+    newConfig.capacity = constrain(this->server->arg("capacity").toInt(), 2, MAX_CONNECTIONS);
+  }
+  if (this->server->hasArg("bufferSize")) {
+    newConfig.bufferSize = constrain(this->server->arg("bufferSize").toInt(), FORWARD_BUFFER_MIN, FORWARD_BUFFER_MAX);
+  }
+  
+  // Warm pool limits (checked again by ESPProxy::begin())
+  newConfig.poolMinFree = POOL_MIN_FREE;
+  newConfig.poolMaxFree = POOL_MAX_FREE;
+  if (this->server->hasArg("poolMinFree")) {
+    newConfig.poolMinFree = constrain(this->server->arg("poolMinFree").toInt(), 1, newConfig.capacity - 1);
+  }
+  if (this->server->hasArg("poolMaxFree")) {
+    newConfig.poolMaxFree = constrain(this->server->arg("poolMaxFree").toInt(), newConfig.poolMinFree, newConfig.capacity - 1);
+  }
+  newConfig.preconnect = DEVICE_PRECONNECT_BUDGET;
+  if (this->server->hasArg("preconnect")) {
+    newConfig.preconnect = constrain(this->server->arg("preconnect").toInt(), 0, newConfig.capacity);
+  }
+  this->readSocketProfile("cloud", newConfig.cloudSocket, CLOUD_SOCKET_DEFAULTS);
+  this->readSocketProfile("dev", newConfig.deviceSocket, DEVICE_SOCKET_DEFAULTS);
+  
   // Parse network configuration
   newConfig.useDHCP = this->server->hasArg("useDHCP");
   if (this->server->hasArg("staticIP")) {
@@ -247,7 +614,7 @@ void WebConfig::handleSave() {
     }
     
     // Send HTML response with restart button
-    this->server->send(200, "text/html", generateSavePage());
+    this->sendPage(SAVED_HTML_GZ, SAVED_HTML_GZ_LEN, SAVED_HTML_ETAG);
   } else {
     this->server->send(500, "text/plain", "Failed to save configuration");
   }
@@ -256,7 +623,8 @@ void WebConfig::handleSave() {
 void WebConfig::handleRestart() {
   Serial.println("[WEB] Restart requested via web interface");
   this->server->send(200, "text/plain", "Restarting ESP32...");
-  this->proxy->cleanStart(true);
+  // The proxy task owns the connections, let it clean up and restart
+  this->proxy->requestRestart();
 }
 
 void WebConfig::handleNotFound() {
@@ -274,75 +642,286 @@ void WebConfig::handleNotFound() {
   this->server->send(404, "text/plain", "404 These are not the droids you're looking for: " + method + " " + uri);
 }
 
-String WebConfig::generateStatusJSON() {
-  int activeCount = this->proxy ? this->proxy->getActiveConnectionCount() : 0;
-  int freeCount = this->proxy ? this->proxy->getFreeConnectionCount() : 0;
-  
-  String json = "{";
-  json += "\"connectionCount\":" + String(activeCount) + ",";
-  json += "\"freeConnections\":" + String(freeCount) + ",";
-  json += "\"maxConnections\":" + String(MAX_CONNECTIONS) + ",";
-  json += "\"bytesTransferred\":" + String(this->proxy ? this->proxy->getTotalBytesTransferred() : 0) + ",";
-  json += "\"clientConnections\":" + String(this->proxy ? this->proxy->getTotalClientConnections() : 0) + ",";
-  json += "\"uptime\":" + String(millis() / 1000) + ",";
-  json += "\"ip\":\"" + ETH.localIP().toString() + "\",";
-  json += "\"connections\":[";
-  
-  // Generate connection details JSON inline
-  if (this->proxy) {
-    bool first = true;
-    for (int i = 0; i < MAX_CONNECTIONS; i++) {
-      Context* conn = this->proxy->getConnection(i);
-      if (conn) {
-        if (!first) json += ",";
-        first = false;
-        
-        json += "{";
-        json += "\"slot\":" + String(i) + ",";
-        json += "\"id\":" + String(conn->getConnectionId()) + ",";
-        json += "\"cloudSocket\":" + String(conn->hasCloudSocket() ? "true" : "false") + ",";
-        json += "\"deviceSocket\":" + String(conn->hasDeviceSocket() ? "true" : "false") + ",";
-        json += "\"cloudConnected\":" + String(conn->isCloudConnected() ? "true" : "false") + ",";
-        json += "\"deviceConnected\":" + String(conn->isDeviceConnected() ? "true" : "false") + ",";
-        json += "\"status\":\"" + String(conn->isFree() ? "FREE" : "ACTIVE") + "\"";
-        json += "}";
-      }
+// JSON pieces, written straight into the response: "name":value followed by separator
+static void jsonNumber(ChunkedWriter& out, const char* name, uint64_t value, char separator = ',') {
+  out.print('"');
+  out.print(name);
+  out.print("\":");
+  out.print(value);
+  if (separator) out.print(separator);
+}
+
+static void jsonBool(ChunkedWriter& out, const char* name, bool value, char separator = ',') {
+  out.print('"');
+  out.print(name);
+  out.print("\":");
+  out.print(value ? "true" : "false");
+  if (separator) out.print(separator);
+}
+
+// "name":"value" followed by separator, value escaped
+static void jsonString(ChunkedWriter& out, const char* name, const char* value, char separator = ',') {
+  out.print('"');
+  out.print(name);
+  out.print("\":\"");
+  for (const char* c = value; *c; c++) {
+    if (*c == '"' || *c == '\\') {
+      out.print('\\');
+      out.print(*c);
+    } else if ((uint8_t)*c < 0x20) {
+      out.printf("\\u%04x", (unsigned)(uint8_t)*c);
+    } else {
+      out.print(*c);
     }
   }
-  
-  json += "]";
-  json += "}";
-  return json;
+  out.print('"');
+  if (separator) out.print(separator);
+}
+
+// "name":{"bytes":..,"chunks":..}
+static void jsonTraffic(ChunkedWriter& out, const char* name, const Traffic& traffic, char separator = ',') {
+  out.print('"');
+  out.print(name);
+  out.print("\":{");
+  jsonNumber(out, "bytes", traffic.bytes);
+  jsonNumber(out, "chunks", traffic.chunks, '}');
+  if (separator) out.print(separator);
+}
+
+// "name":{"noDelay":..,"keepAliveIdle":..,"keepAliveInterval":..,"keepAliveCount":..,"sendBuffer":..}
+static void jsonSocketProfile(ChunkedWriter& out, const char* name, const SocketProfile& profile, char separator = ',') {
+  out.print('"');
+  out.print(name);
+  out.print("\":{");
+  jsonBool(out, "noDelay", profile.noDelay);
+  jsonNumber(out, "keepAliveIdle", profile.keepAliveIdle);
+  jsonNumber(out, "keepAliveInterval", profile.keepAliveInterval);
+  jsonNumber(out, "keepAliveCount", profile.keepAliveCount);
+  jsonNumber(out, "sendBuffer", profile.sendBuffer, '}');
+  if (separator) out.print(separator);
+}
+
+// "name":{"count":..,"p50":..,"p90":..,"p99":..,"max":..} in microseconds
+static void jsonLatency(ChunkedWriter& out, const char* name, const LatencySummary& latency, char separator = ',') {
+  out.print('"');
+  out.print(name);
+  out.print("\":{");
+  jsonNumber(out, "count", latency.count);
+  jsonNumber(out, "p50", latency.p50);
+  jsonNumber(out, "p90", latency.p90);
+  jsonNumber(out, "p99", latency.p99);
+  jsonNumber(out, "max", latency.max, '}');
+  if (separator) out.print(separator);
 }
 
-String WebConfig::generateHTML() {
+void WebConfig::readStatus() {
+  // Copy published by the proxy task - we never touch its connections directly
+  if (!this->proxy || !this->proxy->getStatus(this->status)) {
+    memset(&this->status, 0, sizeof(this->status));
+  }
+}
+
+void WebConfig::writeStatusJSON(ChunkedWriter& out) {
+  this->readStatus();
+  const ProxyStatus& status = this->status;
+  
+  out.print('{');
+  jsonNumber(out, "connectionCount", status.activeConnections);
+  jsonNumber(out, "freeConnections", status.freeConnections);
+  jsonNumber(out, "maxConnections", status.capacity);
+  jsonNumber(out, "bufferSize", status.bufferSize);
+  jsonNumber(out, "bytesTransferred", status.bytesTransferred);
+  jsonNumber(out, "clientConnections", status.clientConnections);
+  jsonTraffic(out, "toDevice", status.toDevice);
+  jsonTraffic(out, "toCloud", status.toCloud);
+  
+  out.print("\"latency\":{");
+  jsonLatency(out, "toDevice", status.latencyToDevice);
+  jsonLatency(out, "toCloud", status.latencyToCloud, '}');
+  out.print(',');
+  
+  out.print("\"pool\":{");
+  jsonNumber(out, "minFree", this->proxy ? this->proxy->getConfig().poolMinFree : 0);
+  jsonNumber(out, "maxFree", this->proxy ? this->proxy->getConfig().poolMaxFree : 0);
+  jsonNumber(out, "target", status.poolTarget);
+  out.printf("\"arrivalRate\":%.3f,", status.arrivalRate);
+  jsonNumber(out, "hits", status.poolHits);
+  jsonNumber(out, "misses", status.poolMisses, '}');
+  out.print(',');
+  
+  // Forwarding cost, compare FORWARD_DIRECT_RECV true/false with the same traffic
+  out.print("\"forwarding\":{");
+  jsonString(out, "mode", FORWARD_DIRECT_RECV ? "direct" : "staged");
+  jsonNumber(out, "cpuUs", status.forwardMicros);
+  jsonNumber(out, "recvCalls", status.forwardRecvCalls);
+  jsonNumber(out, "sendCalls", status.forwardSendCalls, '}');
+  out.print(',');
+  
+  out.print("\"preconnect\":{");
+  jsonNumber(out, "budget", status.preconnectBudget);
+  jsonNumber(out, "open", status.preconnectOpen);
+  jsonNumber(out, "started", status.preconnectStarted);
+  jsonNumber(out, "used", status.preconnectUsed);
+  jsonNumber(out, "dropped", status.preconnectDropped);
+  jsonLatency(out, "ttfbWarm", status.ttfbWarm);
+  jsonLatency(out, "ttfbCold", status.ttfbCold, '}');
+  out.print(',');
+  
+  // Per master, in the order of ProxyConfig::routes
+  out.print("\"routes\":[");
+  for (int r = 0; r < status.routeCount; r++) {
+    const RouteStatus& route = status.routes[r];
+    if (r > 0) out.print(',');
+    out.print('{');
+    jsonString(out, "uniqueId", this->proxy ? this->proxy->getConfig().routes[r].uniqueId : "");
+    jsonNumber(out, "freeConnections", route.freeConnections);
+    jsonNumber(out, "activeConnections", route.activeConnections);
+    jsonNumber(out, "target", route.poolTarget);
+    out.printf("\"arrivalRate\":%.3f,", route.arrivalRate);
+    jsonNumber(out, "hits", route.poolHits);
+    jsonNumber(out, "misses", route.poolMisses);
+    jsonNumber(out, "clientConnections", route.clientConnections);
+    jsonTraffic(out, "toDevice", route.toDevice);
+    jsonTraffic(out, "toCloud", route.toCloud, '}');
+  }
+  out.print("],");
+  
+  out.print("\"dns\":{");
+  jsonNumber(out, "hits", status.dnsHits);
+  jsonNumber(out, "misses", status.dnsMisses);
+  jsonNumber(out, "stale", status.dnsStale);
+  jsonNumber(out, "lookups", status.dnsLookups);
+  jsonNumber(out, "failures", status.dnsFailures, '}');
+  out.print(',');
+  
+  out.print("\"timeouts\":{");
+  jsonNumber(out, "connect", status.connectTimeouts);
+  jsonNumber(out, "heartbeat", status.heartbeatTimeouts);
+  jsonNumber(out, "idle", status.idleTimeouts, '}');
+  out.print(',');
+  
+  out.print("\"outages\":{");
+  jsonNumber(out, "count", status.outages);
+  jsonNumber(out, "current", status.outageMs);
+  jsonNumber(out, "lastRecovery", status.lastRecoveryMs);
+  jsonNumber(out, "maxRecovery", status.maxRecoveryMs);
+  jsonNumber(out, "totalRecovery", status.totalRecoveryMs, '}');
+  out.print(',');
+  
+  out.print("\"heap\":{");
+  jsonNumber(out, "free", status.freeHeap);
+  jsonNumber(out, "minFree", status.minFreeHeap);
+  jsonNumber(out, "largestBlock", status.largestFreeBlock);
+  jsonNumber(out, "minLargestBlock", status.minLargestFreeBlock);
+  jsonNumber(out, "slab", status.slabSize);
+  jsonNumber(out, "slotContext", status.slotBytes);
+  jsonNumber(out, "slotBuffers", status.slotBufferBytes);
+  jsonBool(out, "buffersInPsram", status.buffersInPsram);
+  jsonNumber(out, "psram", status.psramSize);
+  jsonNumber(out, "psramFree", status.psramFree, '}');
+  out.print(',');
+  
+  jsonNumber(out, "logDropped", status.logDropped);
+  jsonNumber(out, "uptime", millis() / 1000);
+  
+  IPAddress ip = ETH.localIP();
+  out.printf("\"ip\":\"%u.%u.%u.%u\",", ip[0], ip[1], ip[2], ip[3]);
+  
+  // Connection details, used slots only
+  out.print("\"connections\":[");
+  bool first = true;
+  for (int i = 0; i < status.capacity; i++) {
+    const SlotStatus& conn = status.slots[i];
+    if (!conn.used) continue;
+    
+    if (!first) out.print(',');
+    first = false;
+    
+    out.print('{');
+    jsonNumber(out, "slot", i);
+    jsonNumber(out, "id", conn.id);
+    jsonNumber(out, "route", conn.route);
+    jsonBool(out, "cloudSocket", conn.cloudSocket);
+    jsonBool(out, "deviceSocket", conn.deviceSocket);
+    jsonBool(out, "cloudConnected", conn.cloudConnected);
+    jsonBool(out, "deviceConnected", conn.deviceConnected);
+    jsonBool(out, "deviceConnecting", conn.deviceConnecting);
+    jsonBool(out, "deviceWarm", conn.deviceWarm);
+    jsonNumber(out, "cloudToDevice", conn.cloudToDevice);
+    jsonNumber(out, "deviceToCloud", conn.deviceToCloud);
+    jsonTraffic(out, "toDevice", conn.toDevice);
+    jsonTraffic(out, "toCloud", conn.toCloud);
+    jsonNumber(out, "age", conn.ageMs);
+    jsonNumber(out, "attached", conn.attachedMs);
+    jsonNumber(out, "idle", conn.idleMs);
+    out.print(conn.free ? "\"status\":\"FREE\"}" : "\"status\":\"ACTIVE\"}");
+  }
+  out.print("]}");
+}
+
+void WebConfig::handleConfig() {
   // Get CURRENT running configuration from the proxy
-  ProxyConfig currentConfig;
+  ProxyConfig config;
   if (this->proxy) {
-    currentConfig = this->proxy->getConfig();
+    config = this->proxy->getConfig();
   } else {
     // Fallback: load from NVRAM (shouldn't happen normally)
-    this->loadConfig(currentConfig);
+    this->loadConfig(config);
   }
   
-  // Ensure static IP fields have values (from config.h if not set in NVRAM)
-  // This way they're always prefilled even when using DHCP
-  if (strlen(currentConfig.staticIP) == 0) {
-    strncpy(currentConfig.staticIP, LOCAL_IP, sizeof(currentConfig.staticIP) - 1);
+  // Static IP fields are always prefilled (from config.h if not set in NVRAM), even when using DHCP
+  if (strlen(config.staticIP) == 0) {
+    strncpy(config.staticIP, LOCAL_IP, sizeof(config.staticIP) - 1);
   }
-  if (strlen(currentConfig.gateway) == 0) {
-    strncpy(currentConfig.gateway, GATEWAY_IP, sizeof(currentConfig.gateway) - 1);
+  if (strlen(config.gateway) == 0) {
+    strncpy(config.gateway, GATEWAY_IP, sizeof(config.gateway) - 1);
   }
-  if (strlen(currentConfig.subnet) == 0) {
-    strncpy(currentConfig.subnet, SUBNET_MASK, sizeof(currentConfig.subnet) - 1);
+  if (strlen(config.subnet) == 0) {
+    strncpy(config.subnet, SUBNET_MASK, sizeof(config.subnet) - 1);
   }
-  if (strlen(currentConfig.dns) == 0) {
-    strncpy(currentConfig.dns, DNS_SERVER, sizeof(currentConfig.dns) - 1);
+  if (strlen(config.dns) == 0) {
+    strncpy(config.dns, DNS_SERVER, sizeof(config.dns) - 1);
   }
   
-  // Use the template function to generate HTML
-  return generateConfigPage(
-    &currentConfig,
-    this->currentMDNS.c_str()
-  );
+  // Settings can change with every /save, never cached
+  this->server->sendHeader("Cache-Control", "no-store");
+  ChunkedWriter out(this->server);
+  out.begin("application/json");
+  out.print('{');
+  jsonString(out, "cloudServer", config.cloudServer);
+  jsonNumber(out, "cloudPort", config.cloudPort);
+  
+  // routes[0] is the main master, the others are the additional ones
+  out.print("\"routes\":[");
+  for (int r = 0; r < config.routeCount; r++) {
+    if (r > 0) out.print(',');
+    out.print('{');
+    jsonString(out, "uniqueId", config.routes[r].uniqueId);
+    jsonString(out, "masterAddress", config.routes[r].masterAddress);
+    jsonNumber(out, "masterPort", config.routes[r].masterPort, '}');
+  }
+  out.print("],");
+  jsonString(out, "mdnsHostname", this->currentMDNS.c_str());
+  jsonBool(out, "debug", config.debug);
+  jsonNumber(out, "poolMinFree", config.poolMinFree);
+  jsonNumber(out, "poolMaxFree", config.poolMaxFree);
+  jsonNumber(out, "preconnect", config.preconnect);
+  jsonNumber(out, "capacity", config.capacity);
+  jsonNumber(out, "bufferSize", config.bufferSize);
+  jsonSocketProfile(out, "cloudSocket", config.cloudSocket);
+  jsonSocketProfile(out, "deviceSocket", config.deviceSocket);
+  jsonBool(out, "useDHCP", config.useDHCP);
+  jsonString(out, "staticIP", config.staticIP);
+  jsonString(out, "gateway", config.gateway);
+  jsonString(out, "subnet", config.subnet);
+  jsonString(out, "dns", config.dns);
+  
+  // Compile-time settings
+  jsonNumber(out, "maxConnections", MAX_CONNECTIONS);
+  jsonNumber(out, "bufferMin", FORWARD_BUFFER_MIN);
+  jsonNumber(out, "bufferMax", FORWARD_BUFFER_MAX);
+  jsonNumber(out, "maxRoutes", MAX_ROUTES);
+  jsonNumber(out, "checkInterval", CONNECTION_CHECK_INTERVAL / 1000);
+  jsonString(out, "version", VERSION, '}');
+  out.end();
 }
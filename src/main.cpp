@@ -5,7 +5,6 @@
  */
 
 #include <ETH.h>
-#include <WiFiClient.h>
 #include "ESPProxy.h"
 #include "WebConfig.h"
 #include "config.h"  // Contains your configuration
@@ -142,15 +141,15 @@ void setup() {
   
   // Config was already loaded earlier for network configuration
   
-  // Start proxy
-  if (proxy.begin(config)) {
+  // Start proxy (in its own task on core 1)
+  if (proxy.begin(config) && proxy.start()) {
     proxy.logInfo("ESP Proxy started successfully!");
   } else {
     proxy.logError("ESP Proxy Failed to start!");
   }
 
-    // Start web configuration interface
-  if (webConfig->begin()) {
+    // Start web configuration interface (in its own task on core 0)
+  if (webConfig->begin() && webConfig->start()) {
     proxy.logInfo("=== Web configuration interface ready!");
     Serial.print("[INFO] === Access at: http://");
       Serial.print(webConfig->getMDNSHostname());
@@ -161,27 +160,22 @@ void setup() {
     proxy.logError("Failed to start web configuration interface!");
   }
 
-  Serial.print("[INFO] === Published '"); 
-    Serial.print(config.uniqueId);
-    Serial.print("' to: ");
-    Serial.print(config.cloudServer);
-    Serial.print(":");
-    Serial.println(config.cloudPort);
-  Serial.print("[INFO] === Proxy is running on "); 
-    Serial.print(config.masterAddress); 
-    Serial.print(":"); 
-    Serial.print(config.masterPort); 
+  for (int r = 0; r < config.routeCount; r++) {
+    Serial.print("[INFO] === Published '"); 
+      Serial.print(config.routes[r].uniqueId);
+      Serial.print("' to: ");
+      Serial.print(config.cloudServer);
+      Serial.print(":");
+      Serial.println(config.cloudPort);
+    Serial.print("[INFO] === Proxy is running on "); 
+      Serial.print(config.routes[r].masterAddress); 
+      Serial.print(":"); 
+      Serial.println(config.routes[r].masterPort); 
+  }
 }
 
 void loop() {
-  // Run the proxy main loop
-  proxy.loop();
-  
-  // Handle web server requests
-  if (webConfig) {
-    webConfig->loop();
-  }
-  
-  // Small delay to prevent watchdog issues
-  delay(10);
+  // Nothing to do here: the proxy runs in its own task on core 1,
+  // the web configuration interface in another one on core 0
+  delay(1000);
 }
@@ -0,0 +1,303 @@
+"""
+Local stand-in for the Duotecno cloud server, to load and soak test the proxy
+
+Point the proxy at this machine (cloud server + port in the web interface),
+and its master at the built-in echo master (or at a real one). The simulator
+then behaves like the cloud:
+  - accepts the proxy's connections and reads the [uniqueId] registration,
+    answers with [OK] and keeps them as free connections per unique ID
+  - sends [215,3] heartbeats on free connections and expects [72,3] back
+  - starts simulated app clients: each takes a free connection of a
+    registered unique ID, sends messages at a given rate and waits for the
+    echo of each one, until its session ends or it is dropped at random
+
+Latency and packet loss are added to the client side of the cloud. TCP never
+loses data, so a lost packet shows up as the retransmission delay it causes
+(--loss-delay). For loss on the wire, run the proxy's traffic through
+netem (tc qdisc add dev <if> root netem loss 1%) instead.
+
+Reported every --report seconds and at the end:
+  - attach latency: client arrival until its first message came back
+    (waiting for a free connection + the proxy connecting to the master)
+  - pool miss rate: clients that found no free connection of their unique ID
+  - round trip of every message, cloud -> proxy -> master -> proxy -> cloud
+
+    python3 tools/cloudsim.py --echo-master 5001 --clients 20 --rate 2 --duration 600
+
+Only the Python standard library is used (3.7+).
+
+Author: Johan Coppieters for Duotecno
+Date: November 2025
+"""
+
+import argparse
+import asyncio
+import random
+import time
+
+HEARTBEAT = b"[215,3]"
+HEARTBEAT_ANSWER = b"[72,3]"
+
+
+class Stats:
+    def __init__(self):
+        self.registrations = 0
+        self.heartbeats = 0
+        self.heartbeat_answers = 0
+        self.clients = 0
+        self.pool_misses = 0
+        self.attach_failures = 0
+        self.dropped = 0
+        self.errors = 0
+        self.messages = 0
+        self.attach = []  # ms
+        self.round_trips = []  # ms
+
+    def report(self, title, elapsed):
+        miss_rate = 100.0 * self.pool_misses / self.clients if self.clients else 0.0
+        print("[SIM] %s after %.0f s: %d registrations, %d clients (%d failed to attach, %d dropped on purpose, %d errors)"
+              % (title, elapsed, self.registrations, self.clients, self.attach_failures, self.dropped, self.errors))
+        print("[SIM]   pool miss rate %.1f%% (%d), heartbeats answered %d / %d"
+              % (miss_rate, self.pool_misses, self.heartbeat_answers, self.heartbeats))
+        print("[SIM]   attach latency  %s" % summary(self.attach))
+        print("[SIM]   round trip      %s (%d messages, %.1f/s)"
+              % (summary(self.round_trips), self.messages, self.messages / elapsed if elapsed else 0.0))
+
+
+def percentile(values, fraction):
+    ordered = sorted(values)
+    return ordered[min(len(ordered) - 1, int(fraction * len(ordered)))]
+
+
+def summary(values):
+    if not values:
+        return "-"
+    return "p50 %.1f ms, p99 %.1f ms, max %.1f ms" % (
+        percentile(values, 0.5), percentile(values, 0.99), max(values))
+
+
+class FreeConnection:
+    """A registered proxy connection, waiting for a client"""
+
+    def __init__(self, unique_id, reader, writer):
+        self.unique_id = unique_id
+        self.reader = reader
+        self.writer = writer
+        self.taken = False
+        self.in_heartbeat = False  # its answer is still on the way, not for a client
+        self.heartbeat_task = None
+
+
+class Cloud:
+    def __init__(self, args):
+        self.args = args
+        self.stats = Stats()
+        self.free = {}  # unique ID -> [FreeConnection]
+        self.free_changed = asyncio.Event()
+
+    ###################
+    # Proxy side      #
+    ###################
+
+    async def handle_proxy(self, reader, writer):
+        # Registration: [uniqueId]
+        try:
+            data = await asyncio.wait_for(reader.readuntil(b"]"), 10)
+        except (asyncio.TimeoutError, asyncio.IncompleteReadError, asyncio.LimitOverrunError, ConnectionError):
+            writer.close()
+            return
+        unique_id = data.decode(errors="replace").strip()[1:-1]
+        self.stats.registrations += 1
+        if self.args.verbose:
+            print("[SIM] Registration of %s" % unique_id)
+        if self.args.ack:
+            writer.write(b"[OK]")
+
+        conn = FreeConnection(unique_id, reader, writer)
+        conn.heartbeat_task = asyncio.ensure_future(self.heartbeats(conn))
+        self.free.setdefault(unique_id, []).append(conn)
+        self.free_changed.set()
+
+    async def heartbeats(self, conn):
+        # Until a client takes the connection: [215,3] -> [72,3]
+        while not conn.taken:
+            await asyncio.sleep(self.args.heartbeat)
+            if conn.taken:
+                return
+            conn.in_heartbeat = True
+            try:
+                conn.writer.write(HEARTBEAT)
+                await conn.writer.drain()
+                self.stats.heartbeats += 1
+                answer = await asyncio.wait_for(conn.reader.readexactly(len(HEARTBEAT_ANSWER)), 5)
+            except (asyncio.TimeoutError, asyncio.IncompleteReadError, ConnectionError):
+                self.drop_free(conn)
+                return
+            finally:
+                conn.in_heartbeat = False
+                self.free_changed.set()
+            if answer == HEARTBEAT_ANSWER:
+                self.stats.heartbeat_answers += 1
+
+    def drop_free(self, conn):
+        pool = self.free.get(conn.unique_id, [])
+        if conn in pool:
+            pool.remove(conn)
+        conn.writer.close()
+
+    async def take_free(self, unique_id, timeout):
+        # Oldest free connection of unique_id, waits for one if needed
+        deadline = time.monotonic() + timeout
+        missed = False
+        while True:
+            pool = [conn for conn in self.free.get(unique_id, []) if not conn.in_heartbeat]
+            if pool:
+                conn = pool[0]
+                self.free[unique_id].remove(conn)
+                conn.taken = True
+                return conn, missed
+            missed = True
+            left = deadline - time.monotonic()
+            if left <= 0:
+                return None, missed
+            self.free_changed.clear()
+            try:
+                await asyncio.wait_for(self.free_changed.wait(), left)
+            except asyncio.TimeoutError:
+                pass
+
+    ###################
+    # Client side     #
+    ###################
+
+    async def network_delay(self):
+        # Latency between app and cloud, and TCP retransmissions for lost packets
+        delay = self.args.latency + random.uniform(-self.args.jitter, self.args.jitter)
+        if random.random() < self.args.loss:
+            delay += self.args.loss_delay
+        if delay > 0:
+            await asyncio.sleep(delay / 1000.0)
+
+    async def client(self, number):
+        args = self.args
+        self.stats.clients += 1
+        arrived = time.monotonic()
+
+        # A client of any unique ID the proxy registered
+        while not self.free:
+            await asyncio.sleep(0.1)
+        unique_id = random.choice(sorted(self.free.keys()))
+        conn, missed = await self.take_free(unique_id, args.attach_timeout)
+        if missed:
+            self.stats.pool_misses += 1
+        if conn is None:
+            self.stats.attach_failures += 1
+            return
+
+        session_end = arrived + random.expovariate(1.0 / args.session)
+        seq = 0
+        try:
+            while time.monotonic() < session_end:
+                # Looks like Duotecno client data: not a heartbeat or a response
+                seq += 1
+                message = ("[52,%d,%d," % (number, seq)).encode()
+                message += b"0" * max(0, args.size - len(message) - 1) + b"]"
+
+                start = time.monotonic()
+                await self.network_delay()
+                conn.writer.write(message)
+                await conn.writer.drain()
+                echo = await asyncio.wait_for(conn.reader.readexactly(len(message)), args.echo_timeout)
+                await self.network_delay()
+                now = time.monotonic()
+                if echo != message:
+                    self.stats.errors += 1
+                    break
+
+                if seq == 1:
+                    self.stats.attach.append((now - arrived) * 1000)
+                self.stats.round_trips.append((now - start) * 1000)
+                self.stats.messages += 1
+
+                if random.random() < args.drop:
+                    self.stats.dropped += 1
+                    break
+                await asyncio.sleep(random.expovariate(args.rate) if args.rate > 0 else 0)
+        except (asyncio.TimeoutError, asyncio.IncompleteReadError, ConnectionError):
+            self.stats.errors += 1
+        finally:
+            conn.writer.close()
+
+    async def clients(self, stop_at):
+        # Keep --clients sessions running, a new one starts when one ends
+        running = set()
+        number = 0
+        while time.monotonic() < stop_at:
+            while len(running) < self.args.clients:
+                number += 1
+                running.add(asyncio.ensure_future(self.client(number)))
+                await asyncio.sleep(random.uniform(0, self.args.ramp))
+            done, running = await asyncio.wait(running, timeout=0.5, return_when=asyncio.FIRST_COMPLETED)
+        for task in running:
+            task.cancel()
+
+
+async def echo_master(reader, writer):
+    try:
+        while True:
+            data = await reader.read(4096)
+            if not data:
+                break
+            writer.write(data)
+            await writer.drain()
+    except ConnectionError:
+        pass
+    writer.close()
+
+
+async def main(args):
+    cloud = Cloud(args)
+    await asyncio.start_server(cloud.handle_proxy, args.host, args.port)
+    print("[SIM] Cloud server on %s:%d" % (args.host, args.port))
+    if args.echo_master:
+        await asyncio.start_server(echo_master, args.host, args.echo_master)
+        print("[SIM] Echo master on %s:%d" % (args.host, args.echo_master))
+
+    start = time.monotonic()
+    stop_at = start + args.duration
+    client_task = asyncio.ensure_future(cloud.clients(stop_at))
+    while time.monotonic() < stop_at:
+        await asyncio.sleep(min(args.report, max(0.0, stop_at - time.monotonic())))
+        if time.monotonic() < stop_at:
+            cloud.stats.report("Progress", time.monotonic() - start)
+    await client_task
+    cloud.stats.report("Done", time.monotonic() - start)
+
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser(description="Duotecno cloud server simulator and load generator for the proxy")
+    parser.add_argument("--host", default="0.0.0.0", help="address to listen on")
+    parser.add_argument("--port", type=int, default=5097, help="cloud server port the proxy connects to")
+    parser.add_argument("--echo-master", type=int, default=0, metavar="PORT",
+                        help="also run a master that echoes everything on PORT (0 = use a real master)")
+    parser.add_argument("--no-ack", dest="ack", action="store_false", help="don't answer registrations with [OK]")
+    parser.add_argument("--heartbeat", type=float, default=20, help="seconds between heartbeats on free connections")
+    parser.add_argument("--clients", type=int, default=5, help="simultaneous simulated app clients")
+    parser.add_argument("--ramp", type=float, default=1.0, help="at most this many seconds between new clients")
+    parser.add_argument("--session", type=float, default=30, help="average client session in seconds")
+    parser.add_argument("--rate", type=float, default=1.0, help="messages per second per client (0 = back to back)")
+    parser.add_argument("--size", type=int, default=32, help="message size in bytes")
+    parser.add_argument("--drop", type=float, default=0.0, help="chance a client drops its connection after a message")
+    parser.add_argument("--latency", type=float, default=0.0, help="ms added between app and cloud, each way")
+    parser.add_argument("--jitter", type=float, default=0.0, help="+/- ms on top of --latency")
+    parser.add_argument("--loss", type=float, default=0.0, help="chance a message is lost and retransmitted")
+    parser.add_argument("--loss-delay", type=float, default=200.0, help="ms a retransmission costs")
+    parser.add_argument("--attach-timeout", type=float, default=10.0, help="seconds a client waits for a free connection")
+    parser.add_argument("--echo-timeout", type=float, default=10.0, help="seconds to wait for the echo of a message")
+    parser.add_argument("--duration", type=float, default=60, help="seconds to run")
+    parser.add_argument("--report", type=float, default=30, help="seconds between progress reports")
+    parser.add_argument("--verbose", action="store_true", help="log every registration")
+    try:
+        asyncio.get_event_loop().run_until_complete(main(parser.parse_args()))
+    except KeyboardInterrupt:
+        pass
@@ -0,0 +1,91 @@
+"""
+Embed the web interface (web/*.html) in the firmware
+
+Every page is gzipped and written to include/WebAssets.h as a PROGMEM
+array, together with its length and an ETag (hash of the compressed
+bytes). The web server sends the bytes as they are, with
+Content-Encoding: gzip, so the pages are never built or compressed on
+the ESP32.
+
+Runs before every build (extra_scripts in platformio.ini) and only rewrites
+the header when a page changed. Can also be run by hand:
+    python3 tools/embed_web.py
+
+Author: Johan Coppieters for Duotecno
+Date: November 2025
+"""
+
+import gzip
+import hashlib
+import os
+
+# PlatformIO runs this as an SCons script (extra_scripts), where __file__ is not set
+try:
+    Import("env")  # noqa: F821
+    ROOT = env["PROJECT_DIR"]  # noqa: F821
+except NameError:
+    ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+WEB_DIR = os.path.join(ROOT, "web")
+OUTPUT = os.path.join(ROOT, "include", "WebAssets.h")
+
+# file in web/ -> C name
+PAGES = [
+    ("index.html", "INDEX_HTML"),
+    ("saved.html", "SAVED_HTML"),
+]
+
+
+def compress(data):
+    # mtime=0: same input, same bytes (and ETag) on every build
+    return gzip.compress(data, compresslevel=9, mtime=0)
+
+
+def c_array(data):
+    lines = []
+    for i in range(0, len(data), 16):
+        lines.append("  " + ", ".join("0x%02x" % b for b in data[i:i + 16]) + ",")
+    return "\n".join(lines)
+
+
+def generate():
+    out = []
+    out.append("/*")
+    out.append(" * Web interface pages, gzipped - GENERATED by tools/embed_web.py from web/")
+    out.append(" * Do not edit, change the page in web/ and rebuild.")
+    out.append(" */")
+    out.append("")
+    out.append("#ifndef WEBASSETS_H")
+    out.append("#define WEBASSETS_H")
+    out.append("")
+    out.append("#include <Arduino.h>")
+    for page, name in PAGES:
+        with open(os.path.join(WEB_DIR, page), "rb") as f:
+            raw = f.read()
+        gz = compress(raw)
+        etag = hashlib.sha1(gz).hexdigest()[:16]
+        out.append("")
+        out.append("// web/%s: %d bytes, %d gzipped" % (page, len(raw), len(gz)))
+        out.append("#define %s_ETAG \"\\\"%s\\\"\"" % (name, etag))
+        out.append("static const size_t %s_GZ_LEN = %d;" % (name, len(gz)))
+        out.append("static const uint8_t %s_GZ[] PROGMEM = {" % name)
+        out.append(c_array(gz))
+        out.append("};")
+    out.append("")
+    out.append("#endif // WEBASSETS_H")
+    return "\n".join(out) + "\n"
+
+
+def main():
+    text = generate()
+    try:
+        with open(OUTPUT) as f:
+            if f.read() == text:
+                return
+    except IOError:
+        pass
+    with open(OUTPUT, "w") as f:
+        f.write(text)
+    print("[WEB] Generated " + os.path.relpath(OUTPUT, ROOT))
+
+
+main()